@@ -1,11 +1,16 @@
-#include <queue>
-#include <set>
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 #include "data_structure/node.h"
 #include "data_structure/node_comparator.h"
 #include "data_structure/problem.h"
+#include "data_structure/reached_set.h"
+#include "data_structure/search_trace.h"
+#include "data_structure/static_problem.h"
+#include "data_structure/successor_generator.h"
 #include "search_algorithm.h"
+#include "search_checkpoint.h"
 
 using namespace search_algorithm;
 
@@ -17,47 +22,104 @@ using NodePtrVector =
     std::vector<std::shared_ptr<Node<State, Action, CostType>>>;
 
 template <typename State, typename Action, typename CostType,
-          typename Comparator>
+          typename Comparator, typename TProblem>
 std::shared_ptr<Node<State, Action, CostType>>
-search_algorithm::BestFirstSearch(
-    Problem<State, Action, CostType> const& problem) {
-    State initialState = problem.GetInitialState();
-    std::shared_ptr<Node<State, Action, CostType>> root =
-        std::make_shared<Node<State, Action, CostType>>(initialState);
+search_algorithm::BestFirstSearch(TProblem const& problem,
+                                  const SearchOptions& options) {
+    using Dispatch = ProblemDispatch<TProblem>;
 
     // Create concrete comparator instance
     Comparator comparator(problem);
 
-    std::priority_queue<
-        // Type of elements in the priority queue
-        std::shared_ptr<Node<State, Action, CostType>>,
-        // Container type for the priority queue
-        std::vector<std::shared_ptr<Node<State, Action, CostType>>>,
-        // Comparator for the priority queue
-        Comparator>
-        frontier(comparator);
+    // Frontier kept as a binary heap with the same operations as
+    // std::priority_queue, but with its array reachable for checkpoints
+    NodePtrVector<State, Action, CostType> frontier;
+    ReachedSet<State, Action, CostType> reached(
+        problem, options.reduce_symmetry, options.fingerprint_reached,
+        options.bloom_bits_per_state);
+    SearchStatistics statistics;
 
-    frontier.push(root);
+    bool checkpointing =
+        !options.checkpoint_path.empty() && options.checkpoint_interval > 0;
+    if (options.fingerprint_reached &&
+        (checkpointing || !options.resume_path.empty()))
+        throw std::invalid_argument(
+            "BestFirstSearch: checkpoints need the reached states, not "
+            "fingerprints");
 
-    std::set<State> reached = std::set<State>();
-    reached.insert(root->GetState());
+    if (!options.resume_path.empty()) {
+        ReadCheckpoint(options.resume_path, &frontier, &reached.GetStates(),
+                       &statistics);
+    } else {
+        State initialState = problem.GetInitialState();
+        frontier.push_back(
+            std::make_shared<Node<State, Action, CostType>>(initialState));
+        reached.InsertNode(frontier.back().get());
+        TraceNode(options.trace, TraceEvent::kGenerate, *frontier.back(),
+                  problem);
+    }
+
+    CheckpointWriter checkpoint_writer(options.checkpoint_in_background);
+    uint64_t last_checkpoint = statistics.expanded;
+
+    auto finish = [&](std::shared_ptr<Node<State, Action, CostType>> result) {
+        if (checkpointing && !checkpoint_writer.Wait())
+            throw std::runtime_error(
+                "BestFirstSearch: checkpoint write failed");
+        if (result)
+            TraceNode(options.trace, TraceEvent::kGoal, *result, problem);
+        // The path must not refer to the reached set, which goes away here
+        for (Node<State, Action, CostType>* node = result.get(); node;
+             node = node->GetParent().get())
+            node->DetachState();
+        statistics.reached = reached.GetSize();
+        statistics.reached_bytes = reached.GetMemoryBytes();
+        if (options.statistics) *options.statistics = statistics;
+        return result;
+    };
 
     // Search
     while (!frontier.empty()) {
-        std::shared_ptr<Node<State, Action, CostType>> node = frontier.top();
-        frontier.pop();
+        std::pop_heap(frontier.begin(), frontier.end(), comparator);
+        std::shared_ptr<Node<State, Action, CostType>> node =
+            std::move(frontier.back());
+        frontier.pop_back();
 
-        if (problem.IsGoal(node->GetState())) return node;
+        if (Dispatch::IsGoal(problem, node->GetState())) return finish(node);
+        if (options.max_expansions > 0 &&
+            statistics.expanded >= options.max_expansions)
+            return finish(nullptr);  // out of budget
 
-        NodePtrVector<State, Action, CostType> children = node->Expand(
-            const_cast<Problem<State, Action, CostType>&>(problem));
-        for (const auto& child : children) {
-            if (reached.find(child->GetState()) == reached.end()) {
-                reached.insert(child->GetState());
-                frontier.push(child);
+        SuccessorGenerator<State, Action, CostType, TProblem> successors(
+            node, problem);
+        TraceNode(options.trace, TraceEvent::kExpand, *node, problem);
+        ++statistics.expanded;
+        while (std::shared_ptr<Node<State, Action, CostType>> child =
+                   successors.Next()) {
+            ++statistics.generated;
+            if (reached.InsertNode(child.get())) {
+                TraceNode(options.trace, TraceEvent::kGenerate, *child,
+                          problem);
+                frontier.push_back(std::move(child));
+                std::push_heap(frontier.begin(), frontier.end(), comparator);
+            } else {
+                ++statistics.duplicates;
+                TraceNode(options.trace, TraceEvent::kDuplicate, *child,
+                          problem);
             }
         }
+
+        // Snapshot between two expansions, where resuming from the file
+        // replays exactly what this run does next
+        if (checkpointing && statistics.expanded - last_checkpoint >=
+                                 options.checkpoint_interval) {
+            if (checkpoint_writer.Write([&]() {
+                    WriteCheckpoint(options.checkpoint_path, frontier,
+                                    reached.GetStates(), statistics);
+                }))
+                last_checkpoint = statistics.expanded;
+        }
     }
 
-    return nullptr;  // failure
-}
\ No newline at end of file
+    return finish(nullptr);  // failure
+}
@@ -1,9 +1,12 @@
 #include <queue>
-#include <set>
 #include <vector>
 
 #include "data_structure/node.h"
 #include "data_structure/problem.h"
+#include "data_structure/reached_set.h"
+#include "data_structure/search_trace.h"
+#include "data_structure/static_problem.h"
+#include "data_structure/successor_generator.h"
 #include "search_algorithm.h"
 
 using namespace search_algorithm;
@@ -12,38 +15,81 @@ using namespace search_algorithm;
 // 4th edition
 
 // Uses a set to avoid redundant paths
-template <typename State, typename Action, typename CostType>
+template <typename State, typename Action, typename CostType,
+          typename TProblem>
 std::shared_ptr<Node<State, Action, CostType>>
 search_algorithm::BreadthFirstSearch(
-    Problem<State, Action, CostType> const& problem) {
+    TProblem const& problem,
+    const SearchOptions& options) {
     using NodeType = Node<State, Action, CostType>;
+    using Dispatch = ProblemDispatch<TProblem>;
+
+    SearchStatistics statistics;
+    ReachedSet<State, Action, CostType> reached(
+        problem, options.reduce_symmetry, options.fingerprint_reached,
+        options.bloom_bits_per_state);
+    auto finish = [&](std::shared_ptr<NodeType> result) {
+        // The path must not refer to the reached set, which goes away here
+        for (NodeType* node = result.get(); node;
+             node = node->GetParent().get())
+            node->DetachState();
+        statistics.reached = reached.GetSize();
+        statistics.reached_bytes = reached.GetMemoryBytes();
+        if (result)
+            TraceNode(options.trace, TraceEvent::kGoal, *result, problem);
+        if (options.statistics) *options.statistics = statistics;
+        return result;
+    };
 
     State initialState = problem.GetInitialState();
     std::shared_ptr<NodeType> root = std::make_shared<NodeType>(initialState);
+    TraceNode(options.trace, TraceEvent::kGenerate, *root, problem);
 
-    if (problem.IsGoal(root->GetState())) return root;
+    if (Dispatch::IsGoal(problem, root->GetState())) return finish(root);
 
     std::queue<std::shared_ptr<NodeType>> fifo_queue =
         std::queue<std::shared_ptr<NodeType>>();
     fifo_queue.push(root);
 
-    std::set<State> reached = std::set<State>();
-    reached.insert(root->GetState());
+    reached.InsertNode(root.get());
 
     while (!fifo_queue.empty()) {
         std::shared_ptr<NodeType> node = fifo_queue.front();
         fifo_queue.pop();
 
-        std::vector<std::shared_ptr<NodeType>> children = node->Expand(
-            const_cast<Problem<State, Action, CostType>&>(problem));
-        for (const auto& child : children) {
-            if (problem.IsGoal(child->GetState())) return child;
-            if (reached.find(child->GetState()) == reached.end()) {
-                reached.insert(child->GetState());
+        // Children are built one at a time, so a goal child ends the search
+        // before its siblings are built
+        SuccessorGenerator<State, Action, CostType, TProblem> successors(
+            node, problem);
+        TraceNode(options.trace, TraceEvent::kExpand, *node, problem);
+        ++statistics.expanded;
+        while (std::shared_ptr<NodeType> child = successors.Next()) {
+            ++statistics.generated;
+            if (Dispatch::IsGoal(problem, child->GetState())) {
+                TraceNode(options.trace, TraceEvent::kGenerate, *child,
+                          problem);
+                return finish(child);
+            }
+            if (reached.InsertNode(child.get())) {
                 fifo_queue.push(child);
+                TraceNode(options.trace, TraceEvent::kGenerate, *child,
+                          problem);
+            } else {
+                ++statistics.duplicates;
+                TraceNode(options.trace, TraceEvent::kDuplicate, *child,
+                          problem);
             }
         }
     }
 
-    return nullptr;  // Failure
-}
\ No newline at end of file
+    return finish(nullptr);  // Failure
+}
+
+template <typename TProblem>
+search_algorithm::ProblemNodePtr<TProblem>
+search_algorithm::BreadthFirstSearch(TProblem const& problem,
+                                     const SearchOptions& options) {
+    using Types = ProblemTypes<TProblem>;
+    return BreadthFirstSearch<typename Types::State, typename Types::Action,
+                              typename Types::Cost, TProblem>(problem, options);
+}
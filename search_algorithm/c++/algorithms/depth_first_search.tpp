@@ -1,9 +1,16 @@
-#include <set>
-#include <stack>
+#include <memory>
+#include <stdexcept>
+#include <unordered_set>
 #include <vector>
 
 #include "data_structure/node.h"
 #include "data_structure/problem.h"
+#include "data_structure/reached_set.h"
+#include "data_structure/search_trace.h"
+#include "data_structure/state_hash.h"
+#include "data_structure/static_problem.h"
+#include "data_structure/successor_generator.h"
+#include "data_structure/visited_cache.h"
 #include "search_algorithm.h"
 
 using namespace search_algorithm;
@@ -11,33 +18,101 @@ using namespace search_algorithm;
 // Reference: page 96, Artificial Intelligence: A Modern Approach,
 // 4th edition
 
-template <typename State, typename Action, typename CostType>
+template <typename State, typename Action, typename CostType,
+          typename TProblem>
 std::shared_ptr<Node<State, Action, CostType>>
 search_algorithm::DepthFirstSearch(
-    Problem<State, Action, CostType> const& problem) {
+    TProblem const& problem,
+    const SearchOptions& options) {
     using NodeType = Node<State, Action, CostType>;
+    using Dispatch = ProblemDispatch<TProblem>;
+
+    if (options.visited_capacity > 0 && !options.dfs_graph_search)
+        throw std::invalid_argument(
+            "DepthFirstSearch: visited_capacity needs dfs_graph_search");
+
+    // Graph search: every visited state, or a bounded cache with clock
+    // eviction
+    ReachedSet<State, Action, CostType> visited(
+        problem, options.reduce_symmetry, options.fingerprint_reached,
+        options.bloom_bits_per_state);
+    std::unique_ptr<VisitedCache<State>> visited_cache;
+    if (options.visited_capacity > 0)
+        visited_cache =
+            std::make_unique<VisitedCache<State>>(options.visited_capacity);
+
+    // The cache can forget states of the current path, so with a cache the
+    // path is checked separately: paths stay acyclic and the search finite
+    std::unordered_set<State, StateHash<State>> on_path;
+
+    auto visit = [&](const State& state) {
+        if (!options.dfs_graph_search) return true;
+        if (!visited_cache) return visited.Insert(state);
+        if (on_path.count(state)) return false;
+        return visited_cache->Insert(
+            options.reduce_symmetry ? Dispatch::Canonicalize(problem, state)
+                                    : state);
+    };
+
+    SearchStatistics statistics;
+    auto finish = [&](std::shared_ptr<NodeType> result) {
+        if (result)
+            TraceNode(options.trace, TraceEvent::kGoal, *result, problem);
+        statistics.reached =
+            visited_cache ? visited_cache->GetSize() : visited.GetSize();
+        if (!visited_cache)
+            statistics.reached_bytes = visited.GetMemoryBytes();
+        if (options.statistics) *options.statistics = statistics;
+        return result;
+    };
 
     auto root = std::make_shared<NodeType>(problem.GetInitialState());
+    TraceNode(options.trace, TraceEvent::kGenerate, *root, problem);
 
-    if (problem.IsGoal(root->GetState())) return root;
+    if (Dispatch::IsGoal(problem, root->GetState())) return finish(root);
+    visit(root->GetState());
+    if (visited_cache) on_path.insert(root->GetState());
 
-    std::stack<std::shared_ptr<NodeType>> lifo_stack =
-        std::stack<std::shared_ptr<NodeType>>();
-    lifo_stack.push(root);
+    // One generator per level of the current path: the search descends into
+    // each child as soon as it is built, siblings are built on the way back
+    std::vector<SuccessorGenerator<State, Action, CostType, TProblem>> path;
+    path.emplace_back(root, problem);
+    TraceNode(options.trace, TraceEvent::kExpand, *root, problem);
+    ++statistics.expanded;
 
-    while (!lifo_stack.empty()) {
-        std::shared_ptr<NodeType> node = lifo_stack.top();
-        lifo_stack.pop();
+    while (!path.empty()) {
+        std::shared_ptr<NodeType> child = path.back().Next();
+        if (!child) {
+            if (visited_cache) on_path.erase(path.back().GetNode()->GetState());
+            path.pop_back();
+            continue;
+        }
 
-        std::vector<std::shared_ptr<NodeType>> children = node->Expand(
-            const_cast<Problem<State, Action, CostType>&>(problem));
-        for (const auto& child : children) {
-            // DEBUG not sure if this is the correct place for goal test, but
-            // makes sense
-            if (problem.IsGoal(child->GetState())) return child;
-            lifo_stack.push(child);
+        ++statistics.generated;
+        bool is_goal = Dispatch::IsGoal(problem, child->GetState());
+        if (!is_goal && !visit(child->GetState())) {
+            ++statistics.duplicates;
+            TraceNode(options.trace, TraceEvent::kDuplicate, *child, problem);
+            continue;
         }
+
+        TraceNode(options.trace, TraceEvent::kGenerate, *child, problem);
+        if (is_goal) return finish(child);
+
+        if (visited_cache) on_path.insert(child->GetState());
+        path.emplace_back(child, problem);
+        TraceNode(options.trace, TraceEvent::kExpand, *child, problem);
+        ++statistics.expanded;
     }
 
-    return nullptr;  // Failure
-}
\ No newline at end of file
+    return finish(nullptr);  // Failure
+}
+
+template <typename TProblem>
+search_algorithm::ProblemNodePtr<TProblem>
+search_algorithm::DepthFirstSearch(TProblem const& problem,
+                                   const SearchOptions& options) {
+    using Types = ProblemTypes<TProblem>;
+    return DepthFirstSearch<typename Types::State, typename Types::Action,
+                            typename Types::Cost, TProblem>(problem, options);
+}
@@ -1,9 +1,13 @@
-#include <set>
-#include <stack>
+#include <algorithm>
+#include <unordered_set>
 #include <vector>
 
 #include "data_structure/node.h"
 #include "data_structure/problem.h"
+#include "data_structure/search_trace.h"
+#include "data_structure/state_hash.h"
+#include "data_structure/static_problem.h"
+#include "data_structure/successor_generator.h"
 #include "search_algorithm.h"
 
 using namespace search_algorithm;
@@ -11,38 +15,110 @@ using namespace search_algorithm;
 // Reference: figure 3.12, page 99, Artificial Intelligence: A Modern Approach,
 // 4th edition
 
-template <typename State, typename Action, typename CostType>
+template <typename State, typename Action, typename CostType,
+          typename TProblem>
 std::shared_ptr<Node<State, Action, CostType>>
 search_algorithm::DepthLimitedSearch(
-    Problem<State, Action, CostType> const& problem, uint64_t depth_limit,
-    bool check_node_cycles, bool* out_cutoff) {
+    TProblem const& problem, uint64_t depth_limit,
+    bool check_node_cycles, bool* out_cutoff, const SearchOptions& options) {
     using NodeType = Node<State, Action, CostType>;
+    using Dispatch = ProblemDispatch<TProblem>;
 
-    auto root = std::make_shared<NodeType>(problem.GetInitialState());
+    TranspositionTable* table = options.transposition_table;
+    StateHash<State> hash;
 
-    std::stack<std::shared_ptr<NodeType>> lifo_stack =
-        std::stack<std::shared_ptr<NodeType>>();
-    lifo_stack.push(root);
+    SearchStatistics statistics;
+    auto finish = [&](std::shared_ptr<NodeType> result) {
+        if (result)
+            TraceNode(options.trace, TraceEvent::kGoal, *result, problem);
+        if (options.statistics) *options.statistics = statistics;
+        return result;
+    };
 
+    // One generator per level of the current path, as in DepthFirstSearch.
+    // With check_node_cycles the states of the path are also kept in a hash
+    // set, pushed on descent and popped on backtrack, so the cycle check is
+    // one probe instead of a walk up the ancestors (Node::IsCycle)
+    std::vector<SuccessorGenerator<State, Action, CostType, TProblem>> path;
+    std::unordered_set<State, StateHash<State>> on_path;
     bool cutoff_occurred = false;
 
-    while (!lifo_stack.empty()) {
-        std::shared_ptr<NodeType> node = lifo_stack.top();
-        lifo_stack.pop();
+    // Goal test, then expansion of a node within the depth limit that
+    // closes no cycle and is not covered by the transposition table
+    auto enter = [&](const std::shared_ptr<NodeType>& node) {
+        if (Dispatch::IsGoal(problem, node->GetState()))
+            return true;  // Solution found
 
-        if (problem.IsGoal(node->GetState())) return node;  // Solution found
+        if (node->GetDepth() > depth_limit) {
+            cutoff_occurred = true;
+            return false;
+        }
 
-        if (node->GetDepth() <= depth_limit) {
-            if (check_node_cycles && node->IsCycle()) continue;
+        if (check_node_cycles && on_path.count(node->GetState())) {
+            ++statistics.duplicates;
+            TraceNode(options.trace, TraceEvent::kPrune, *node, problem);
+            return false;
+        }
 
-            std::vector<std::shared_ptr<NodeType>> children = node->Expand(
-                const_cast<Problem<State, Action, CostType>&>(problem));
-            for (const auto& child : children) lifo_stack.push(child);
-        } else
-            cutoff_occurred = true;
+        // A state already expanded with at least as many moves left has its
+        // subtree covered (or being covered, it is an ancestor)
+        if (table) {
+            uint64_t key =
+                options.reduce_symmetry
+                    ? hash(Dispatch::Canonicalize(problem, node->GetState()))
+                    : hash(node->GetState());
+            uint16_t remaining = static_cast<uint16_t>(std::min<uint64_t>(
+                depth_limit - node->GetDepth(), UINT16_MAX));
+            TranspositionTable::Entry entry;
+            if (table->Probe(key, &entry) &&
+                entry.generation == table->GetGeneration() &&
+                entry.depth >= remaining) {
+                ++statistics.duplicates;
+                TraceNode(options.trace, TraceEvent::kPrune, *node, problem);
+                return false;
+            }
+            table->Store(key, remaining);
+        }
+
+        if (check_node_cycles) on_path.insert(node->GetState());
+        path.emplace_back(node, problem);
+        TraceNode(options.trace, TraceEvent::kExpand, *node, problem);
+        ++statistics.expanded;
+        return false;
+    };
+
+    auto root = std::make_shared<NodeType>(problem.GetInitialState());
+    TraceNode(options.trace, TraceEvent::kGenerate, *root, problem);
+    if (enter(root)) return finish(root);
+
+    while (!path.empty()) {
+        std::shared_ptr<NodeType> child = path.back().Next();
+        if (!child) {
+            if (check_node_cycles)
+                on_path.erase(path.back().GetNode()->GetState());
+            path.pop_back();
+            continue;
+        }
+
+        ++statistics.generated;
+        TraceNode(options.trace, TraceEvent::kGenerate, *child, problem);
+        if (enter(child)) return finish(child);
     }
 
     if (cutoff_occurred) *out_cutoff = true;
 
-    return nullptr;  // Failure or cutoff (cutoff is indicated via out_cutoff)
-}
\ No newline at end of file
+    // Failure or cutoff (cutoff is indicated via out_cutoff)
+    return finish(nullptr);
+}
+
+template <typename TProblem>
+search_algorithm::ProblemNodePtr<TProblem>
+search_algorithm::DepthLimitedSearch(TProblem const& problem,
+                                     uint64_t depth_limit,
+                                     bool check_node_cycles, bool* out_cutoff,
+                                     const SearchOptions& options) {
+    using Types = ProblemTypes<TProblem>;
+    return DepthLimitedSearch<typename Types::State, typename Types::Action,
+                              typename Types::Cost, TProblem>(
+        problem, depth_limit, check_node_cycles, out_cutoff, options);
+}
@@ -0,0 +1,176 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "data_structure/node.h"
+#include "data_structure/problem.h"
+#include "data_structure/search_trace.h"
+#include "data_structure/state_store.h"
+#include "data_structure/static_problem.h"
+#include "data_structure/successor_generator.h"
+#include "search_algorithm.h"
+
+using namespace search_algorithm;
+
+// Reference: J. Pearl and J. H. Kim, "Studies in Semi-Admissible Heuristics",
+// IEEE Transactions on Pattern Analysis and Machine Intelligence, 1982
+
+template <typename State, typename Action, typename CostType,
+          typename TProblem>
+std::shared_ptr<Node<State, Action, CostType>> search_algorithm::FocalSearch(
+    TProblem const& problem, double weight, const SearchOptions& options,
+    std::function<double(const Node<State, Action, CostType>&)> focal_key) {
+    using NodeType = Node<State, Action, CostType>;
+    using Dispatch = ProblemDispatch<TProblem>;
+
+    if (!(weight >= 1.0))
+        throw std::invalid_argument("FocalSearch: weight must be at least 1");
+
+    /**
+     * @brief A node waiting in the open list
+     */
+    struct Entry {
+        std::shared_ptr<NodeType> node;  ///< nullptr once expanded
+        uint32_t state_id;               ///< Id in the state store
+        double f;                        ///< g + h
+        double h;                        ///< Heuristic
+        double focal;                    ///< Secondary key
+    };
+
+    // Entries are named by their index. Focal ties go to the lower h (the
+    // deeper node for f-like keys), then to the older entry
+    std::vector<Entry> entries;
+    std::set<std::pair<double, uint64_t>> open;            // (f, entry)
+    std::set<std::tuple<double, double, uint64_t>> focal;  // (key, h, entry)
+    double bound = 0;  // weight * f_min as of the last update_focal
+
+    // Cheapest path cost found to every state, by state id
+    StateStore<State> states;
+    std::vector<CostType> best_cost;
+
+    SearchStatistics statistics;
+    auto finish = [&](std::shared_ptr<NodeType> result) {
+        if (result)
+            TraceNode(options.trace, TraceEvent::kGoal, *result, problem);
+        // The path must not refer to the store, which goes away here
+        for (NodeType* node = result.get(); node;
+             node = node->GetParent().get())
+            node->DetachState();
+        statistics.reached = states.GetSize();
+        statistics.reached_bytes = states.GetMemoryBytes();
+        if (options.statistics) *options.statistics = statistics;
+        return result;
+    };
+
+    auto focal_entry = [&](uint64_t index) {
+        return std::make_tuple(entries[index].focal, entries[index].h, index);
+    };
+
+    // Moves the focal boundary to weight * f_min: walks the open nodes
+    // between the old and the new boundary in f order
+    auto update_focal = [&]() {
+        if (open.empty()) return;
+        double new_bound = weight * open.begin()->first;
+        constexpr uint64_t kLast = std::numeric_limits<uint64_t>::max();
+        if (new_bound > bound) {
+            for (auto it = open.upper_bound({bound, kLast});
+                 it != open.end() && it->first <= new_bound; ++it)
+                focal.insert(focal_entry(it->second));
+        } else if (new_bound < bound) {
+            for (auto it = open.upper_bound({new_bound, kLast});
+                 it != open.end() && it->first <= bound; ++it)
+                focal.erase(focal_entry(it->second));
+        }
+        bound = new_bound;
+    };
+
+    auto push = [&](std::shared_ptr<NodeType> node, uint32_t state_id,
+                    double h) {
+        double f = static_cast<double>(node->GetPathCost()) + h;
+        double key = focal_key ? focal_key(*node)
+                               : static_cast<double>(node->GetPathCost()) +
+                                     weight * h;
+        uint64_t index = entries.size();
+        entries.push_back(Entry{std::move(node), state_id, f, h, key});
+        open.emplace(f, index);
+        if (f <= bound) focal.insert(focal_entry(index));
+    };
+
+    auto root = std::make_shared<NodeType>(problem.GetInitialState());
+    TraceNode(options.trace, TraceEvent::kGenerate, *root, problem);
+    uint32_t root_id = root->InternState(&states).first;
+    best_cost.push_back(root->GetPathCost());
+    double root_h =
+        static_cast<double>(Dispatch::Heuristic(problem, root->GetState()));
+    push(std::move(root), root_id, root_h);
+    update_focal();
+
+    // Children of the current expansion waiting for their heuristic values
+    std::vector<std::shared_ptr<NodeType>> children;
+    std::vector<uint32_t> child_ids;
+    std::vector<const State*> child_states;
+    std::vector<CostType> child_h;
+
+    while (!focal.empty()) {
+        uint64_t index = std::get<2>(*focal.begin());
+        Entry& entry = entries[index];
+        focal.erase(focal.begin());
+        open.erase({entry.f, index});
+        std::shared_ptr<NodeType> node = std::move(entry.node);
+
+        // A cheaper path to the state was queued after this one
+        if (node->GetPathCost() > best_cost[entry.state_id]) {
+            update_focal();
+            continue;
+        }
+
+        if (Dispatch::IsGoal(problem, node->GetState())) return finish(node);
+        if (options.max_expansions > 0 &&
+            statistics.expanded >= options.max_expansions)
+            return finish(nullptr);  // out of budget
+
+        SuccessorGenerator<State, Action, CostType, TProblem> successors(
+            node, problem);
+        TraceNode(options.trace, TraceEvent::kExpand, *node, problem);
+        ++statistics.expanded;
+        while (std::shared_ptr<NodeType> child = successors.Next()) {
+            ++statistics.generated;
+            std::pair<uint32_t, bool> interned = child->InternState(&states);
+            uint32_t state_id = interned.first;
+            if (interned.second) {
+                best_cost.push_back(child->GetPathCost());
+            } else {
+                if (!(child->GetPathCost() < best_cost[state_id])) {
+                    ++statistics.duplicates;
+                    TraceNode(options.trace, TraceEvent::kDuplicate, *child,
+                              problem);
+                    continue;
+                }
+                // Reopened: the child keeps its own copy of the state
+                best_cost[state_id] = child->GetPathCost();
+            }
+            TraceNode(options.trace, TraceEvent::kGenerate, *child, problem);
+            children.push_back(std::move(child));
+            child_ids.push_back(state_id);
+        }
+
+        // Heuristic values of the new children in one batch
+        child_states.clear();
+        for (const std::shared_ptr<NodeType>& child : children)
+            child_states.push_back(&child->GetState());
+        Dispatch::HeuristicBatch(problem, child_states, &child_h);
+        for (std::size_t i = 0; i < children.size(); ++i)
+            push(std::move(children[i]), child_ids[i],
+                 static_cast<double>(child_h[i]));
+        children.clear();
+        child_ids.clear();
+        update_focal();
+    }
+
+    return finish(nullptr);  // failure
+}
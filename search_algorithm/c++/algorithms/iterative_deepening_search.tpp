@@ -1,5 +1,3 @@
-#include <set>
-#include <stack>
 #include <vector>
 
 #include "data_structure/node.h"
@@ -11,16 +9,47 @@ using namespace search_algorithm;
 // Reference: figure 3.12, page 99, Artificial Intelligence: A Modern Approach,
 // 4th edition
 
-template <typename State, typename Action, typename CostType>
-std::shared_ptr<Node<State, Action, CostType>> search_algorithm::IterativeDeepeningSearch(
-    Problem<State, Action, CostType> const& problem) {
+template <typename State, typename Action, typename CostType,
+          typename TProblem>
+std::shared_ptr<Node<State, Action, CostType>>
+search_algorithm::IterativeDeepeningSearch(
+    TProblem const& problem,
+    const SearchOptions& options) {
     std::shared_ptr<Node<State, Action, CostType>> result = nullptr;
 
+    // Entries of failed iterations stay valid for the next, deeper ones, but
+    // not those of earlier searches that stopped at a goal
+    if (options.transposition_table)
+        options.transposition_table->NewGeneration();
+
+    // Every iteration reports its own counters, the total is reported here
+    SearchOptions iteration_options = options;
+    SearchStatistics iteration, total;
+    iteration_options.statistics = &iteration;
+
     // Increase depth limit until solution is found
     for (uint64_t depth = 0;; ++depth) {
         bool cutoff_occurred = false;
-        result = DepthLimitedSearch(problem, depth, true, &cutoff_occurred);
-        if (!cutoff_occurred)
+        result = DepthLimitedSearch<State, Action, CostType>(
+            problem, depth, true, &cutoff_occurred, iteration_options);
+        total.expanded += iteration.expanded;
+        total.generated += iteration.generated;
+        total.duplicates += iteration.duplicates;
+
+        if (!cutoff_occurred) {
+            if (options.statistics) *options.statistics = total;
             return result;  // Solution found or it doesn't exist
+        }
     }
-}
\ No newline at end of file
+}
+
+template <typename TProblem>
+search_algorithm::ProblemNodePtr<TProblem>
+search_algorithm::IterativeDeepeningSearch(TProblem const& problem,
+                                           const SearchOptions& options) {
+    using Types = ProblemTypes<TProblem>;
+    return IterativeDeepeningSearch<typename Types::State,
+                                    typename Types::Action,
+                                    typename Types::Cost, TProblem>(problem,
+                                                                    options);
+}
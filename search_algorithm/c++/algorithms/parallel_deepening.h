@@ -0,0 +1,134 @@
+/**
+ * @file parallel_deepening.h
+ * @brief Iterative deepening on a work-stealing thread pool
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_ALGORITHMS_PARALLEL_DEEPENING_H_
+#define SEARCH_ALG_ALGORITHMS_PARALLEL_DEEPENING_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "data_structure/node.h"
+#include "data_structure/problem.h"
+#include "data_structure/search_trace.h"
+#include "data_structure/successor_generator.h"
+#include "data_structure/work_stealing_pool.h"
+#include "search_options.h"
+
+namespace search_algorithm {
+
+/**
+ * @brief Engine shared by the parallel iterative deepening searches
+ *
+ * Each iteration is a depth-first search that prunes nodes whose value
+ * f(n) exceeds a threshold; the next iteration's threshold is the smallest
+ * value pruned. With f(n) = depth this is iterative deepening, with
+ * f(n) = g(n) + h(n) it is IDA*.
+ *
+ * An iteration starts as a single task for the root. A task searches its
+ * subtree like DepthLimitedSearch, with one successor generator per level
+ * and the states of the path in a hash set for cycle checks. Whenever the
+ * pool has idle workers, the task hands the untried children of its
+ * shallowest level over as new tasks, so large subtrees keep being split
+ * while small ones run to the end without overhead.
+ *
+ * The threshold is shared by all tasks of an iteration. The first task to
+ * reach a goal sets a flag that every task checks before each step, so the
+ * other workers stop within one node expansion.
+ *
+ * @tparam State Type representing problem states
+ * @tparam Action Type representing actions/moves
+ * @tparam CostType Type for action costs
+ * @tparam Evaluator Callable returning f(n) as a double for a node
+ */
+template <typename State, typename Action, typename CostType,
+          typename Evaluator>
+class ParallelDeepening {
+   public:
+    using NodeType = Node<State, Action, CostType>;
+
+    /**
+     * @param problem The problem instance to solve, must outlive the engine
+     * @param options Settings: statistics, trace and num_threads
+     * @param evaluator f(n) of a node
+     * @param early_goal_test Also goal-test the nodes pruned by the
+     * threshold. Saves most of the last iteration, but the goal is only
+     * guaranteed optimal when f grows by the same step along every action,
+     * as depth does.
+     */
+    ParallelDeepening(const Problem<State, Action, CostType>& problem,
+                      const SearchOptions& options, Evaluator evaluator,
+                      bool early_goal_test)
+        : problem_(problem),
+          options_(options),
+          evaluator_(evaluator),
+          early_goal_test_(early_goal_test),
+          pool_(options.num_threads) {}
+
+    /**
+     * @brief Runs iterations until a goal is found or nothing was pruned
+     * @return Goal node, or nullptr if no solution exists
+     * @throws Whatever the problem's methods throw in a worker
+     */
+    std::shared_ptr<NodeType> Run();
+
+   private:
+    using Generator = SuccessorGenerator<State, Action, CostType>;
+
+    const Problem<State, Action, CostType>& problem_;
+    const SearchOptions& options_;
+    Evaluator evaluator_;
+    bool early_goal_test_;
+    WorkStealingPool pool_;
+
+    double threshold_ = 0;                ///< Current iteration's bound
+    std::atomic<double> next_threshold_;  ///< Smallest f(n) above it
+    std::atomic<bool> found_{false};
+
+    std::mutex mutex_;  ///< Guards solution_ and trace writes
+    std::shared_ptr<NodeType> solution_;
+
+    std::atomic<uint64_t> expanded_{0};
+    std::atomic<uint64_t> generated_{0};
+    std::atomic<uint64_t> duplicates_{0};
+
+    /**
+     * @brief Searches the subtree of a node within the threshold
+     * @param node Root of the subtree, goal-tested and bounded by the task
+     */
+    void RunTask(const std::shared_ptr<NodeType>& node);
+
+    /**
+     * @brief Hands the untried children of the shallowest unfinished level
+     * of a path over to the pool
+     * @param path Generators of the task's current path
+     * @param statistics Counters of the task
+     */
+    void Donate(std::vector<Generator>& path, SearchStatistics* statistics);
+
+    /**
+     * @brief Lowers the next threshold to f if it is smaller
+     * @param f Value of a pruned node
+     */
+    void LowerNextThreshold(double f);
+
+    /**
+     * @brief Writes a trace record, serialized between the workers
+     * @param event What happened to the node
+     * @param node The node
+     */
+    void Trace(TraceEvent event, const NodeType& node);
+};
+
+}  // namespace search_algorithm
+
+// Include template implementation
+#include "parallel_deepening.tpp"
+
+#endif  // SEARCH_ALG_ALGORITHMS_PARALLEL_DEEPENING_H_
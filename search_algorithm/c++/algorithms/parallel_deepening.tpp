@@ -0,0 +1,140 @@
+#include <limits>
+#include <unordered_set>
+
+#include "data_structure/state_hash.h"
+
+namespace search_algorithm {
+
+template <typename State, typename Action, typename CostType,
+          typename Evaluator>
+std::shared_ptr<Node<State, Action, CostType>>
+ParallelDeepening<State, Action, CostType, Evaluator>::Run() {
+    auto root = std::make_shared<NodeType>(problem_.GetInitialState());
+    threshold_ = evaluator_(*root);
+
+    for (;;) {
+        next_threshold_ = std::numeric_limits<double>::infinity();
+        Trace(TraceEvent::kGenerate, *root);
+        pool_.Submit([this, root]() { RunTask(root); });
+        pool_.Wait();
+
+        // Done when a goal was found or no node was pruned by the threshold
+        double next = next_threshold_;
+        if (found_ || next == std::numeric_limits<double>::infinity()) break;
+        threshold_ = next;
+    }
+
+    if (solution_) Trace(TraceEvent::kGoal, *solution_);
+    if (options_.statistics) {
+        SearchStatistics statistics;
+        statistics.expanded = expanded_;
+        statistics.generated = generated_;
+        statistics.duplicates = duplicates_;
+        *options_.statistics = statistics;
+    }
+    return solution_;
+}
+
+template <typename State, typename Action, typename CostType,
+          typename Evaluator>
+void ParallelDeepening<State, Action, CostType, Evaluator>::RunTask(
+    const std::shared_ptr<NodeType>& node) {
+    if (found_.load(std::memory_order_relaxed)) return;
+
+    SearchStatistics statistics;
+    std::vector<Generator> path;
+
+    // Ancestors of the task's root are on its path too
+    std::unordered_set<State, StateHash<State>> on_path;
+    for (auto parent = node->GetParent(); parent; parent = parent->GetParent())
+        on_path.insert(parent->GetState());
+
+    // Bound check, goal test, cycle check, then expansion; true at a goal
+    auto enter = [&](const std::shared_ptr<NodeType>& entered) {
+        double f = evaluator_(*entered);
+        if (f > threshold_) {
+            if (early_goal_test_ && problem_.IsGoal(entered->GetState()))
+                return true;
+            LowerNextThreshold(f);
+            return false;
+        }
+
+        if (problem_.IsGoal(entered->GetState())) return true;
+
+        if (on_path.count(entered->GetState())) {
+            ++statistics.duplicates;
+            Trace(TraceEvent::kPrune, *entered);
+            return false;
+        }
+
+        on_path.insert(entered->GetState());
+        path.emplace_back(entered, problem_);
+        Trace(TraceEvent::kExpand, *entered);
+        ++statistics.expanded;
+        return false;
+    };
+
+    std::shared_ptr<NodeType> goal = enter(node) ? node : nullptr;
+    while (!goal && !path.empty()) {
+        if (found_.load(std::memory_order_relaxed)) break;
+        if (pool_.HasIdleWorkers()) Donate(path, &statistics);
+
+        std::shared_ptr<NodeType> child = path.back().Next();
+        if (!child) {
+            on_path.erase(path.back().GetNode()->GetState());
+            path.pop_back();
+            continue;
+        }
+
+        ++statistics.generated;
+        Trace(TraceEvent::kGenerate, *child);
+        if (enter(child)) goal = child;
+    }
+
+    if (goal) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!solution_) solution_ = goal;
+        found_ = true;
+    }
+
+    expanded_ += statistics.expanded;
+    generated_ += statistics.generated;
+    duplicates_ += statistics.duplicates;
+}
+
+template <typename State, typename Action, typename CostType,
+          typename Evaluator>
+void ParallelDeepening<State, Action, CostType, Evaluator>::Donate(
+    std::vector<Generator>& path, SearchStatistics* statistics) {
+    // The shallowest level holds the largest untried subtrees
+    for (Generator& generator : path) {
+        if (!generator.HasNext()) continue;
+
+        while (std::shared_ptr<NodeType> child = generator.Next()) {
+            ++statistics->generated;
+            Trace(TraceEvent::kGenerate, *child);
+            pool_.Submit([this, child]() { RunTask(child); });
+        }
+        return;
+    }
+}
+
+template <typename State, typename Action, typename CostType,
+          typename Evaluator>
+void ParallelDeepening<State, Action, CostType, Evaluator>::LowerNextThreshold(
+    double f) {
+    double next = next_threshold_.load(std::memory_order_relaxed);
+    while (f < next && !next_threshold_.compare_exchange_weak(next, f)) {
+    }
+}
+
+template <typename State, typename Action, typename CostType,
+          typename Evaluator>
+void ParallelDeepening<State, Action, CostType, Evaluator>::Trace(
+    TraceEvent event, const NodeType& node) {
+    if (!options_.trace) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    TraceNode(options_.trace, event, node, problem_);
+}
+
+}  // namespace search_algorithm
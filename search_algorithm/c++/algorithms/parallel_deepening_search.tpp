@@ -0,0 +1,39 @@
+#include "data_structure/node.h"
+#include "data_structure/problem.h"
+#include "parallel_deepening.h"
+#include "search_algorithm.h"
+
+using namespace search_algorithm;
+
+template <typename State, typename Action, typename CostType>
+std::shared_ptr<Node<State, Action, CostType>>
+search_algorithm::ParallelIterativeDeepeningSearch(
+    Problem<State, Action, CostType> const& problem,
+    const SearchOptions& options) {
+    auto depth = [](const Node<State, Action, CostType>& node) {
+        return static_cast<double>(node.GetDepth());
+    };
+
+    // Like DepthLimitedSearch, goal-test the children one level past the
+    // limit: none shallower exists after the previous iterations
+    ParallelDeepening<State, Action, CostType, decltype(depth)> search(
+        problem, options, depth, true);
+    return search.Run();
+}
+
+// Reference: Korf, "Depth-first iterative-deepening: an optimal admissible
+// tree search", Artificial Intelligence 27, 1985
+
+template <typename State, typename Action, typename CostType>
+std::shared_ptr<Node<State, Action, CostType>>
+search_algorithm::ParallelIDAStarSearch(
+    Problem<State, Action, CostType> const& problem,
+    const SearchOptions& options) {
+    auto f = [&problem](const Node<State, Action, CostType>& node) {
+        return static_cast<double>(node.GetPathCost()) +
+               static_cast<double>(problem.Heuristic(node.GetState()));
+    };
+    ParallelDeepening<State, Action, CostType, decltype(f)> search(
+        problem, options, f, false);
+    return search.Run();
+}
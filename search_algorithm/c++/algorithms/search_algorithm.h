@@ -8,10 +8,13 @@
 #ifndef SEARCH_ALG_ALGORITHMS_SEARCH_ALGORITHM_H_
 #define SEARCH_ALG_ALGORITHMS_SEARCH_ALGORITHM_H_
 
+#include <functional>
+
 #include "data_structure/node.h"
 #include "data_structure/node_comparator.h"
 #include "data_structure/problem.h"
 #include "data_structure/problems/sliding_tile_problem.h"
+#include "search_options.h"
 
 /**
  * @namespace search_algorithm
@@ -24,54 +27,132 @@
  * Algorithms include:
  * - Uninformed search: BFS, DFS, DLS, IDS, UCS
  * - Informed search: Best-first search (can be used for A*, Greedy, etc.)
+ * - Bounded-suboptimal search: focal search
+ * - Parallel iterative deepening: IDS and IDA* on a thread pool
  */
 namespace search_algorithm {
 
+/**
+ * @brief Goal node type of a search on a problem class (see ProblemTypes)
+ */
+template <typename TProblem>
+using ProblemNodePtr =
+    std::shared_ptr<Node<typename ProblemTypes<TProblem>::State,
+                         typename ProblemTypes<TProblem>::Action,
+                         typename ProblemTypes<TProblem>::Cost>>;
+
 /**
  * @brief Breadth-First Search algorithm
  *
+ * Children are built one at a time and goal-tested as they are built, so
+ * the search returns without building the siblings after a goal child.
+ *
  * @tparam State Type representing problem states
  * @tparam Action Type representing actions/moves
  * @tparam CostType Type for action costs (default: float)
+ * @tparam TProblem Static type of the problem, deduced from the argument;
+ * a StaticProblem class has its calls bound at compile time (see
+ * BestFirstSearch)
  * @param problem The problem instance to solve
+ * @param options Optional settings (statistics, trace)
  * @return Shared pointer to goal node, or nullptr if no solution exists
  */
-template <typename State, typename Action, typename CostType>
+template <typename State, typename Action, typename CostType,
+          typename TProblem = Problem<State, Action, CostType>>
 std::shared_ptr<Node<State, Action, CostType>> BreadthFirstSearch(
-    Problem<State, Action, CostType> const& problem);
+    TProblem const& problem, const SearchOptions& options = SearchOptions());
+
+/**
+ * @brief Breadth-First Search with State, Action and CostType taken from the
+ * problem's Problem base, so callers need not name them
+ */
+template <typename TProblem>
+ProblemNodePtr<TProblem> BreadthFirstSearch(
+    TProblem const& problem, const SearchOptions& options = SearchOptions());
 
 /**
  * @brief Depth-First Search algorithm
  *
+ * Descends into each child as soon as it is built, trying actions in the
+ * order the problem lists them; only the current path and one pending
+ * action list per level are kept in memory.
+ *
+ * By default this is a tree search, which never ends on state spaces with
+ * cycles. With options.dfs_graph_search, states already visited are skipped.
+ * options.visited_capacity bounds the visited states remembered (clock
+ * eviction, see VisitedCache). Forgotten states may be explored again, and
+ * states on the current path are always recognized, so the search still
+ * terminates on finite state spaces.
+ *
  * @tparam State Type representing problem states
  * @tparam Action Type representing actions/moves
  * @tparam CostType Type for action costs
+ * @tparam TProblem Static type of the problem, deduced from the argument;
+ * a StaticProblem class has its calls bound at compile time (see
+ * BestFirstSearch)
  * @param problem The problem instance to solve
+ * @param options Optional settings (statistics, trace, graph search)
  * @return Shared pointer to goal node, or nullptr if no solution exists
+ * @throws std::invalid_argument if options.visited_capacity is set without
+ * options.dfs_graph_search
  */
-template <typename State, typename Action, typename CostType>
+template <typename State, typename Action, typename CostType,
+          typename TProblem = Problem<State, Action, CostType>>
 std::shared_ptr<Node<State, Action, CostType>> DepthFirstSearch(
-    Problem<State, Action, CostType> const& problem);
+    TProblem const& problem, const SearchOptions& options = SearchOptions());
+
+/**
+ * @brief Depth-First Search with State, Action and CostType taken from the
+ * problem's Problem base, so callers need not name them
+ */
+template <typename TProblem>
+ProblemNodePtr<TProblem> DepthFirstSearch(
+    TProblem const& problem, const SearchOptions& options = SearchOptions());
 
 /**
  * @brief Depth-Limited Search algorithm
  *
+ * Depth-first with one lazy successor generator per level of the current
+ * path, so memory is O(depth) nodes.
+ *
  * @tparam State Type representing problem states
  * @tparam Action Type representing actions/moves
  * @tparam CostType Type for action costs
+ * @tparam TProblem Static type of the problem, deduced from the argument;
+ * a StaticProblem class has its calls bound at compile time (see
+ * BestFirstSearch)
  * @param problem The problem instance to solve
  * @param depth_limit Maximum depth to search
- * @param check_node_cycles If true, check for cycles (more expensive but avoids
- * redundant paths)
+ * @param check_node_cycles If true, prune nodes whose state is already on
+ * the current path; the path's states are kept in a hash set, so the check
+ * is one probe per node
  * @param out_cutoff Output parameter: set to true if cutoff occurred, false if
  * no solution exists
+ * @param options Optional settings (statistics, trace); with a transposition
+ * table, states already expanded in the table's current generation with at
+ * least as many moves left are pruned
  * @return Shared pointer to goal node, or nullptr if no solution within depth
  * limit
+ *
+ * @note Entries stored by a search that found a goal may describe subtrees
+ * that were never finished. Call TranspositionTable::NewGeneration() before
+ * reusing a table for another search.
  */
-template <typename State, typename Action, typename CostType>
+template <typename State, typename Action, typename CostType,
+          typename TProblem = Problem<State, Action, CostType>>
 std::shared_ptr<Node<State, Action, CostType>> DepthLimitedSearch(
-    Problem<State, Action, CostType> const& problem, uint64_t depth_limit,
-    bool check_node_cycles, bool* out_cutoff);
+    TProblem const& problem, uint64_t depth_limit,
+    bool check_node_cycles, bool* out_cutoff,
+    const SearchOptions& options = SearchOptions());
+
+/**
+ * @brief Depth-Limited Search with State, Action and CostType taken from the
+ * problem's Problem base, so callers need not name them
+ */
+template <typename TProblem>
+ProblemNodePtr<TProblem> DepthLimitedSearch(
+    TProblem const& problem, uint64_t depth_limit, bool check_node_cycles,
+    bool* out_cutoff, const SearchOptions& options = SearchOptions());
 
 /**
  * @brief Iterative Deepening Search algorithm
@@ -82,12 +163,68 @@ std::shared_ptr<Node<State, Action, CostType>> DepthLimitedSearch(
  * @tparam State Type representing problem states
  * @tparam Action Type representing actions/moves
  * @tparam CostType Type for action costs
+ * @tparam TProblem Static type of the problem, deduced from the argument;
+ * a StaticProblem class has its calls bound at compile time (see
+ * BestFirstSearch)
  * @param problem The problem instance to solve
+ * @param options Optional settings; a transposition table starts a new
+ * generation and is shared by all iterations
  * @return Shared pointer to goal node, or nullptr if no solution exists
  */
-template <typename State, typename Action, typename CostType>
+template <typename State, typename Action, typename CostType,
+          typename TProblem = Problem<State, Action, CostType>>
 std::shared_ptr<Node<State, Action, CostType>> IterativeDeepeningSearch(
-    Problem<State, Action, CostType> const& problem);
+    TProblem const& problem, const SearchOptions& options = SearchOptions());
+
+/**
+ * @brief Iterative Deepening Search with State, Action and CostType taken from
+ * the problem's Problem base, so callers need not name them
+ */
+template <typename TProblem>
+ProblemNodePtr<TProblem> IterativeDeepeningSearch(
+    TProblem const& problem, const SearchOptions& options = SearchOptions());
+
+/**
+ * @brief Iterative Deepening Search on a pool of worker threads
+ *
+ * Same iterations as IterativeDeepeningSearch, each one split into subtree
+ * tasks that run on a work-stealing thread pool (see ParallelDeepening).
+ * Returns a shallowest goal; which one may vary between runs.
+ *
+ * @tparam State Type representing problem states
+ * @tparam Action Type representing actions/moves
+ * @tparam CostType Type for action costs
+ * @param problem The problem instance to solve; its methods are called from
+ * several threads at once and must be safe for concurrent calls
+ * @param options Optional settings: statistics, trace and num_threads
+ * @return Shared pointer to goal node, or nullptr if no solution exists
+ */
+template <typename State, typename Action, typename CostType>
+std::shared_ptr<Node<State, Action, CostType>> ParallelIterativeDeepeningSearch(
+    Problem<State, Action, CostType> const& problem,
+    const SearchOptions& options = SearchOptions());
+
+/**
+ * @brief IDA* on a pool of worker threads
+ *
+ * Iterative deepening on f(n) = g(n) + h(n): each iteration prunes nodes
+ * whose f exceeds the threshold, and the next threshold is the smallest f
+ * pruned. Iterations run as subtree tasks on a work-stealing thread pool
+ * (see ParallelDeepening). With an admissible heuristic the goal returned is
+ * optimal.
+ *
+ * @tparam State Type representing problem states
+ * @tparam Action Type representing actions/moves
+ * @tparam CostType Type for action costs
+ * @param problem The problem instance to solve; its methods are called from
+ * several threads at once and must be safe for concurrent calls
+ * @param options Optional settings: statistics, trace and num_threads
+ * @return Shared pointer to goal node, or nullptr if no solution exists
+ */
+template <typename State, typename Action, typename CostType>
+std::shared_ptr<Node<State, Action, CostType>> ParallelIDAStarSearch(
+    Problem<State, Action, CostType> const& problem,
+    const SearchOptions& options = SearchOptions());
 
 /**
  * @brief Best-First Search algorithm with custom node comparator
@@ -98,18 +235,73 @@ std::shared_ptr<Node<State, Action, CostType>> IterativeDeepeningSearch(
  * @tparam State Type representing problem states
  * @tparam Action Type representing actions/moves
  * @tparam CostType Type for action costs
- * @tparam Comparator Concrete comparator type (e.g., CompareByAStar)
+ * @tparam Comparator Concrete comparator type (e.g., CompareByAStar),
+ * constructed from the problem
+ * @tparam TProblem Static type of the problem, deduced from the argument.
+ * For a StaticProblem class (SlidingTileProblem, FixedSlidingTileProblem,
+ * ChessBoardProblem) the problem calls are bound at compile time; pass a
+ * Problem reference to go through the vtable.
  * @param problem The problem instance to solve
- * @return Shared pointer to goal node, or nullptr if no solution exists
+ * @param options Optional settings: statistics, trace, periodic checkpoints
+ * of the frontier, reached set and counters to options.checkpoint_path, and
+ * resuming from options.resume_path. A resumed search continues exactly as
+ * the checkpointed one would have. options.max_expansions bounds the run.
+ * @return Shared pointer to goal node, or nullptr if no solution exists or
+ * the expansion budget ran out
+ * @throws std::runtime_error if a checkpoint cannot be written or read
+ * @throws std::invalid_argument if checkpoints are combined with
+ * options.fingerprint_reached
  *
  * @note Use node_comparators::CompareByPathCost for UCS
  * @note Use node_comparators::CompareByAStar for A* search
  */
 template <typename State, typename Action, typename CostType,
-          typename Comparator>
+          typename Comparator,
+          typename TProblem = Problem<State, Action, CostType>>
 std::shared_ptr<Node<State, Action, CostType>> BestFirstSearch(
-    Problem<State, Action, CostType> const& problem,
-    Comparator const& comparator);
+    TProblem const& problem, const SearchOptions& options = SearchOptions());
+
+/**
+ * @brief Focal search: A* with a suboptimality bound (A*epsilon)
+ *
+ * Keeps the open list ordered by f(n) = g(n) + h(n) and, beside it, a focal
+ * list of the open nodes with f(n) <= weight * f_min, ordered by a
+ * secondary key, lower h first on ties. Expands the first focal node. With
+ * an admissible heuristic the goal returned costs at most weight times the
+ * optimal cost; weight 1 is A*.
+ *
+ * The default key is the weighted f, g(n) + weight * h(n): within the
+ * bound the search behaves like weighted A*. A pure distance-to-go key such
+ * as h(n) or an estimate of the remaining actions can be passed instead,
+ * but tends to dive into deep nodes that later leave the focal list as
+ * f_min lags (see focal_search_benchmark).
+ *
+ * Both lists are ordered sets: as f_min rises, the open nodes whose f now
+ * fits under the bound are walked in f order and added to the focal list,
+ * and removed again if f_min drops. A state reached again on a cheaper path
+ * is reopened, which the bound relies on.
+ *
+ * @tparam State Type representing problem states
+ * @tparam Action Type representing actions/moves
+ * @tparam CostType Type for action costs
+ * @tparam TProblem Static type of the problem, deduced from the argument
+ * (see BestFirstSearch)
+ * @param problem The problem instance to solve
+ * @param weight Suboptimality bound, at least 1
+ * @param options Optional settings (statistics, trace, max_expansions)
+ * @param focal_key Secondary key of the focal list, lower first; nullptr
+ * for g(n) + weight * h(n)
+ * @return Shared pointer to goal node, or nullptr if no solution exists or
+ * the expansion budget ran out
+ * @throws std::invalid_argument if weight is below 1
+ */
+template <typename State, typename Action, typename CostType,
+          typename TProblem = Problem<State, Action, CostType>>
+std::shared_ptr<Node<State, Action, CostType>> FocalSearch(
+    TProblem const& problem, double weight,
+    const SearchOptions& options = SearchOptions(),
+    std::function<double(const Node<State, Action, CostType>&)> focal_key =
+        nullptr);
 
 /**
  * @brief Uniform Cost Search algorithm
@@ -141,5 +333,7 @@ std::shared_ptr<Node<State, Action, CostType>> UniformCostSearch(
 #include "breadth_first_search.tpp"
 #include "depth_first_search.tpp"
 #include "depth_limited_search.tpp"
+#include "focal_search.tpp"
 #include "iterative_deepening_search.tpp"
+#include "parallel_deepening_search.tpp"
 #endif  // SEARCH_ALG_ALGORITHMS_SEARCH_ALGORITHM_H_
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * @file search_checkpoint.h
+ * @brief Snapshots of a running best-first search
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_ALGORITHMS_SEARCH_CHECKPOINT_H_
+#define SEARCH_ALG_ALGORITHMS_SEARCH_CHECKPOINT_H_
+
+#include <sys/types.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "data_structure/node.h"
+#include "data_structure/serializer.h"
+#include "data_structure/state_store.h"
+#include "search_options.h"
+
+namespace search_algorithm {
+
+/**
+ * @brief Writes a search snapshot to a binary file
+ *
+ * The file holds the statistics, every node the frontier still refers to
+ * (frontier nodes and their ancestors, parents first), the frontier in heap
+ * order and the reached states. It is written to path + ".tmp" and renamed,
+ * so an interrupted write never replaces a good snapshot.
+ *
+ * @tparam State Type representing problem states, needs a Serializer
+ * @tparam Action Type representing actions, needs a Serializer
+ * @tparam CostType Type for action costs
+ * @param path Destination file
+ * @param frontier Frontier nodes in heap order
+ * @param reached Reached states
+ * @param statistics Counters of the run so far
+ * @throws std::runtime_error if the file cannot be written
+ */
+template <typename State, typename Action, typename CostType>
+void WriteCheckpoint(
+    const std::string& path,
+    const std::vector<std::shared_ptr<Node<State, Action, CostType>>>&
+        frontier,
+    const StateStore<State>& reached, const SearchStatistics& statistics);
+
+/**
+ * @brief Reads a snapshot written by WriteCheckpoint
+ *
+ * @param path Snapshot file
+ * @param out_frontier Output: frontier nodes in the saved heap order, with
+ * their ancestors rebuilt
+ * @param out_reached Output: reached states
+ * @param out_statistics Output: counters at the time of the snapshot
+ * @throws std::runtime_error if the file is missing or malformed
+ */
+template <typename State, typename Action, typename CostType>
+void ReadCheckpoint(
+    const std::string& path,
+    std::vector<std::shared_ptr<Node<State, Action, CostType>>>* out_frontier,
+    StateStore<State>* out_reached, SearchStatistics* out_statistics);
+
+/**
+ * @brief Runs snapshot writes, in a forked child when asked to
+ *
+ * A forked child gets a copy-on-write image of the search, so the parent
+ * only pauses for the fork itself and keeps searching while the child
+ * writes. At most one child runs at a time; a snapshot requested while the
+ * previous one is still being written is skipped.
+ *
+ * @note Only use the background mode from single-threaded searches.
+ */
+class CheckpointWriter {
+   public:
+    /**
+     * @param in_background Write from a forked child instead of inline
+     */
+    explicit CheckpointWriter(bool in_background)
+        : in_background_(in_background) {}
+
+    ~CheckpointWriter() { Wait(); }
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    /**
+     * @brief Writes a snapshot
+     * @param write Callable doing the actual write, may throw
+     * @return false if skipped because the previous write is still running
+     * @throws std::runtime_error if this or the previous write failed
+     */
+    template <typename WriteFunction>
+    bool Write(WriteFunction write);
+
+    /**
+     * @brief Waits for the background write, if any
+     * @return false if it failed
+     */
+    bool Wait();
+
+   private:
+    bool in_background_;
+    pid_t child_ = -1;  ///< Running writer process, -1 if none
+
+    /**
+     * @brief Reaps a finished writer without blocking
+     * @return false if the writer is still running
+     * @throws std::runtime_error if it failed
+     */
+    bool Reap();
+};
+
+}  // namespace search_algorithm
+
+#include "search_checkpoint.tpp"
+
+#endif  // SEARCH_ALG_ALGORITHMS_SEARCH_CHECKPOINT_H_
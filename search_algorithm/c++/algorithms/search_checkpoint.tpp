@@ -0,0 +1,190 @@
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "search_checkpoint.h"
+
+namespace search_algorithm {
+
+namespace checkpoint_format {
+
+constexpr uint32_t kMagic = 0x50434153;  // "SACP"
+constexpr uint32_t kVersion = 4;
+constexpr uint64_t kNoParent = UINT64_MAX;
+
+}  // namespace checkpoint_format
+
+template <typename State, typename Action, typename CostType>
+void WriteCheckpoint(
+    const std::string& path,
+    const std::vector<std::shared_ptr<Node<State, Action, CostType>>>&
+        frontier,
+    const StateStore<State>& reached, const SearchStatistics& statistics) {
+    using NodeType = Node<State, Action, CostType>;
+    using namespace checkpoint_format;
+
+    // Number the nodes parents first, so reading can link them in one pass
+    std::unordered_map<const NodeType*, uint64_t> index;
+    std::vector<const NodeType*> nodes;
+    std::vector<const NodeType*> chain;
+    for (const auto& leaf : frontier) {
+        for (const NodeType* node = leaf.get(); node && !index.count(node);
+             node = node->GetParent().get())
+            chain.push_back(node);
+        for (; !chain.empty(); chain.pop_back()) {
+            index.emplace(chain.back(), nodes.size());
+            nodes.push_back(chain.back());
+        }
+    }
+
+    std::string temp_path = path + ".tmp";
+    std::vector<char> buffer(1 << 20);  // States are many small writes
+    std::ofstream out;
+    out.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    out.open(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("WriteCheckpoint: cannot open " + temp_path);
+
+    Serialize(out, kMagic);
+    Serialize(out, kVersion);
+    Serialize(out, statistics);
+
+    Serialize(out, static_cast<uint64_t>(nodes.size()));
+    for (const NodeType* node : nodes) {
+        const NodeType* parent = node->GetParent().get();
+        Serialize(out, parent ? index.at(parent) : kNoParent);
+        Serialize(out, node->GetAction());
+        Serialize(out, node->GetPathCost());
+        Serialize(out, node->GetState());
+    }
+
+    Serialize(out, static_cast<uint64_t>(frontier.size()));
+    for (const auto& node : frontier) Serialize(out, index.at(node.get()));
+
+    Serialize(out, static_cast<uint64_t>(reached.GetSize()));
+    for (std::size_t id = 0; id < reached.GetSize(); ++id)
+        Serialize(out, reached.Get(static_cast<uint32_t>(id)));
+
+    out.close();
+    if (!out || std::rename(temp_path.c_str(), path.c_str()) != 0)
+        throw std::runtime_error("WriteCheckpoint: cannot write " + path);
+}
+
+template <typename State, typename Action, typename CostType>
+void ReadCheckpoint(
+    const std::string& path,
+    std::vector<std::shared_ptr<Node<State, Action, CostType>>>* out_frontier,
+    StateStore<State>* out_reached, SearchStatistics* out_statistics) {
+    using NodeType = Node<State, Action, CostType>;
+    using namespace checkpoint_format;
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("ReadCheckpoint: cannot open " + path);
+
+    uint32_t magic = 0, version = 0;
+    Deserialize(in, &magic);
+    Deserialize(in, &version);
+    if (magic != kMagic || version != kVersion)
+        throw std::runtime_error("ReadCheckpoint: not a checkpoint: " + path);
+    Deserialize(in, out_statistics);
+
+    uint64_t num_nodes = 0;
+    Deserialize(in, &num_nodes);
+    std::vector<std::shared_ptr<NodeType>> nodes;
+    nodes.reserve(num_nodes);
+    for (uint64_t i = 0; i < num_nodes; ++i) {
+        uint64_t parent = 0;
+        Action action{};
+        CostType path_cost = 0;
+        State state;
+        Deserialize(in, &parent);
+        Deserialize(in, &action);
+        Deserialize(in, &path_cost);
+        Deserialize(in, &state);
+        if (parent != kNoParent && parent >= i)
+            throw std::runtime_error("ReadCheckpoint: corrupt node table");
+
+        nodes.push_back(std::make_shared<NodeType>(
+            std::move(state), parent == kNoParent ? nullptr : nodes[parent],
+            action, path_cost));
+    }
+
+    uint64_t frontier_size = 0;
+    Deserialize(in, &frontier_size);
+    out_frontier->clear();
+    out_frontier->reserve(frontier_size);
+    for (uint64_t i = 0; i < frontier_size; ++i) {
+        uint64_t node = 0;
+        Deserialize(in, &node);
+        if (node >= nodes.size())
+            throw std::runtime_error("ReadCheckpoint: corrupt frontier");
+        out_frontier->push_back(nodes[node]);
+    }
+
+    uint64_t reached_size = 0;
+    Deserialize(in, &reached_size);
+    out_reached->Clear();
+    for (uint64_t i = 0; i < reached_size; ++i) {
+        State state;
+        Deserialize(in, &state);
+        out_reached->Intern(std::move(state));
+    }
+}
+
+template <typename WriteFunction>
+bool CheckpointWriter::Write(WriteFunction write) {
+    if (!in_background_) {
+        write();
+        return true;
+    }
+
+    if (!Reap()) return false;
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        write();  // No child, fall back to writing inline
+        return true;
+    }
+
+    if (pid == 0) {
+        // Child: skip destructors and stdio buffers owned by the parent
+        int status = 0;
+        try {
+            write();
+        } catch (...) {
+            status = 1;
+        }
+        _exit(status);
+    }
+
+    child_ = pid;
+    return true;
+}
+
+inline bool CheckpointWriter::Reap() {
+    if (child_ < 0) return true;
+
+    int status = 0;
+    if (waitpid(child_, &status, WNOHANG) == 0) return false;
+
+    child_ = -1;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        throw std::runtime_error("CheckpointWriter: background write failed");
+    return true;
+}
+
+inline bool CheckpointWriter::Wait() {
+    if (child_ < 0) return true;
+
+    int status = 0;
+    pid_t pid = waitpid(child_, &status, 0);
+    child_ = -1;
+    return pid > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+}  // namespace search_algorithm
@@ -0,0 +1,98 @@
+/**
+ * @file search_options.h
+ * @brief Optional settings shared by the search algorithms
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_ALGORITHMS_SEARCH_OPTIONS_H_
+#define SEARCH_ALG_ALGORITHMS_SEARCH_OPTIONS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "data_structure/search_trace.h"
+#include "data_structure/transposition_table.h"
+
+namespace search_algorithm {
+
+/**
+ * @brief Counters filled in by the searches that support them
+ */
+struct SearchStatistics {
+    uint64_t expanded = 0;    ///< Nodes whose successors were generated
+    uint64_t generated = 0;   ///< Successor nodes created
+    uint64_t duplicates = 0;  ///< Successors dropped as already reached
+    uint64_t reached = 0;     ///< Reached set size when the search returned
+    uint64_t reached_bytes = 0;  ///< Memory the reached set held then
+};
+
+/**
+ * @brief Optional settings of a search run
+ *
+ * Every member defaults to "off", so a default-constructed SearchOptions
+ * behaves like the plain algorithm.
+ */
+struct SearchOptions {
+    /// Table depth-first searches record explored states in and prune
+    /// repeated ones with; not owned, may be shared between threads
+    TranspositionTable* transposition_table = nullptr;
+
+    /// Counters of the run, written when the search returns; not owned
+    SearchStatistics* statistics = nullptr;
+
+    /// Receives a record per generated, expanded, duplicate, pruned and goal
+    /// node; not owned
+    TraceWriter* trace = nullptr;
+
+    /// File best-first search snapshots its progress to, empty to disable
+    std::string checkpoint_path;
+
+    /// Expansions between two snapshots
+    uint64_t checkpoint_interval = 0;
+
+    /// Write snapshots from a forked copy-on-write child instead of pausing
+    /// the search for the whole write
+    bool checkpoint_in_background = true;
+
+    /// Snapshot to resume best-first search from instead of the initial state
+    std::string resume_path;
+
+    /// Key reached sets and transposition tables on Problem::Canonicalize,
+    /// one state per symmetry class; a resumed search must use the same
+    /// setting as the run that wrote the snapshot
+    bool reduce_symmetry = false;
+
+    /// Reached sets keep 64-bit fingerprints instead of states: far less
+    /// memory, but a new state whose fingerprint collides with a reached
+    /// one is dropped as a duplicate. Not supported with checkpoints.
+    bool fingerprint_reached = false;
+
+    /// Bloom filter bits per state in front of fingerprint reached sets, 0
+    /// for no filter
+    std::size_t bloom_bits_per_state = 0;
+
+    /// Depth-first search skips states it has already visited (graph
+    /// search) instead of following every path
+    bool dfs_graph_search = false;
+
+    /// Depth-first graph search remembers at most this many visited states,
+    /// forgetting states not found again since the clock hand last passed
+    /// them (second-chance eviction, see VisitedCache); 0 for no bound.
+    /// Needs dfs_graph_search.
+    std::size_t visited_capacity = 0;
+
+    /// Best-first and focal search give up and return nullptr after this
+    /// many expansions, 0 for no bound; a run that stopped on the budget
+    /// reports statistics.expanded >= max_expansions
+    uint64_t max_expansions = 0;
+
+    /// Worker threads of the parallel searches, 0 for one per hardware
+    /// thread
+    std::size_t num_threads = 0;
+};
+
+}  // namespace search_algorithm
+
+#endif  // SEARCH_ALG_ALGORITHMS_SEARCH_OPTIONS_H_
@@ -0,0 +1,137 @@
+/**
+ * @file search_player.h
+ * @brief Drives the display of a visual search: stepping, auto-play or
+ * headless
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_ALGORITHMS_VISUAL_SEARCH_PLAYER_H_
+#define SEARCH_ALG_ALGORITHMS_VISUAL_SEARCH_PLAYER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "data_structure/problem.h"
+#include "data_structure/visual/search_view.h"
+#include "data_structure/visual/terminal_ui.h"
+#include "visual_options.h"
+
+namespace visual_search {
+
+/**
+ * @brief Shows a visual search according to its PlaybackMode
+ *
+ * The search reports tree and frontier events to GetView() and calls
+ * NextStep() before every expansion:
+ *
+ * - kStep: NextStep() draws the view and waits for Enter.
+ * - kAutoPlay: a render thread draws the view at most max_frames_per_second
+ *   times per second and reads the controls, while the search runs on the
+ *   calling thread. After each frame the render thread asks for the
+ *   frontier window to be formatted, and the next NextStep() does it on the
+ *   search thread, so the render thread never calls the problem. NextStep()
+ *   only blocks while the user has paused and sleeps the expansion delay,
+ *   if one is set. Controls: space pauses and resumes, 'n' runs one
+ *   expansion while paused, '+' and '-' halve and double the delay between
+ *   expansions, 'q' stops the search.
+ * - kHeadless: nothing is drawn, GetView() is nullptr and NextStep() returns
+ *   at once.
+ *
+ * @tparam State The type representing the state of the problem
+ * @tparam Action The type representing actions that can be taken
+ * @tparam CostType The type used for path costs
+ */
+template <typename State, typename Action, typename CostType>
+class SearchPlayer {
+   public:
+    using ViewType = SearchView<State, Action, CostType>;
+
+    /**
+     * @brief Opens the terminal UI and starts the render thread, as the
+     * playback mode requires
+     * @param problem Problem being searched, used to format states on the
+     * search thread
+     * @param options Display settings
+     */
+    SearchPlayer(const Problem<State, Action, CostType>& problem,
+                 const VisualOptions& options);
+
+    /**
+     * @brief Finishes the playback, see Finish()
+     */
+    ~SearchPlayer() { Finish(); }
+
+    SearchPlayer(const SearchPlayer&) = delete;
+    SearchPlayer& operator=(const SearchPlayer&) = delete;
+
+    /**
+     * @brief Gets the view the search reports its events to
+     * @return The view, nullptr when headless
+     */
+    ViewType* GetView() { return view_.get(); }
+
+    /**
+     * @brief Waits until the search may expand its next node
+     * @return false if the user stopped the search
+     */
+    bool NextStep();
+
+    /**
+     * @brief Ends auto-play: draws the final frame, waits for Enter unless
+     * the user stopped the search, and joins the render thread
+     */
+    void Finish();
+
+   private:
+    static constexpr int kTreeWindow = 0;
+    static constexpr int kFrontierWindow = 1;
+    static constexpr uint32_t kMaxDelayMs = 2000;
+
+    VisualOptions options_;
+    std::unique_ptr<TerminalUI> ui_;
+    std::unique_ptr<ViewType> view_;
+    std::thread render_thread_;
+
+    // Playback controls, shared by the search and render threads
+    std::mutex control_mutex_;
+    std::condition_variable control_cv_;
+    bool paused_ = false;
+    uint64_t steps_ = 0;  ///< Expansions granted while paused
+    uint32_t delay_ms_ = 0;
+    bool stopped_ = false;   ///< The user quit
+    bool finished_ = false;  ///< The search returned
+
+    /// Set by the render thread after a frame, cleared by the search thread
+    /// once it has formatted the frontier window
+    std::atomic<bool> frame_requested_{true};
+
+    /**
+     * @brief Body of the render thread
+     */
+    void RenderLoop();
+
+    /**
+     * @brief Applies a playback control key
+     * @param key Key read from the terminal
+     */
+    void HandleKey(int key);
+
+    /**
+     * @brief Formats the status bar of auto-play
+     * @return Counts, playback state and key help
+     */
+    std::string GetAutoPlayStatus();
+};
+
+}  // namespace visual_search
+
+// Include template implementation
+#include "search_player.tpp"
+
+#endif  // SEARCH_ALG_ALGORITHMS_VISUAL_SEARCH_PLAYER_H_
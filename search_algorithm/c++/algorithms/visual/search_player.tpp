@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#include "search_player.h"
+
+namespace visual_search {
+
+template <typename State, typename Action, typename CostType>
+SearchPlayer<State, Action, CostType>::SearchPlayer(
+    const Problem<State, Action, CostType>& problem,
+    const VisualOptions& options)
+    : options_(options), delay_ms_(options.expansion_delay_ms) {
+    if (options_.playback == PlaybackMode::kHeadless) return;
+
+    int columns_layout = 2;
+    ui_ = std::make_unique<TerminalUI>(columns_layout);
+    view_ = std::make_unique<ViewType>(problem,
+                                       options_.collapse_closed_subtrees);
+
+    // From here on, only the render thread touches the terminal
+    if (options_.playback == PlaybackMode::kAutoPlay)
+        render_thread_ = std::thread(&SearchPlayer::RenderLoop, this);
+}
+
+template <typename State, typename Action, typename CostType>
+bool SearchPlayer<State, Action, CostType>::NextStep() {
+    switch (options_.playback) {
+        case PlaybackMode::kHeadless:
+            return true;
+
+        case PlaybackMode::kStep:
+            view_->FormatFrontierWindow(ui_->GetColumnHeight());
+            view_->Render(*ui_, kTreeWindow, kFrontierWindow);
+            ui_->PrintToStatusBar(
+                "Nodes: " + std::to_string(view_->GetNumNodes()) +
+                "  Frontier: " + std::to_string(view_->GetFrontierSize()) +
+                "  Press Enter to continue...");
+            ui_->RefreshAll();
+
+            // Wait for user input to proceed
+            ui_->WaitForKey('\n');
+            return true;
+
+        case PlaybackMode::kAutoPlay:
+            break;
+    }
+
+    // The frontier only changes between steps, so formatting it before
+    // waiting while paused keeps the paused frames complete
+    bool format = frame_requested_.exchange(false);
+    std::unique_lock<std::mutex> lock(control_mutex_);
+    if (format || (paused_ && !steps_)) {
+        lock.unlock();
+        view_->FormatFrontierWindow(ui_->GetColumnHeight());
+        lock.lock();
+    }
+    control_cv_.wait(lock, [this] { return stopped_ || !paused_ || steps_; });
+    if (stopped_) return false;
+    if (paused_) --steps_;
+    uint32_t delay_ms = delay_ms_;
+    lock.unlock();
+
+    if (delay_ms > 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+    return true;
+}
+
+template <typename State, typename Action, typename CostType>
+void SearchPlayer<State, Action, CostType>::Finish() {
+    if (!render_thread_.joinable()) return;
+
+    view_->FormatFrontierWindow(ui_->GetColumnHeight());  // Final frame
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        finished_ = true;
+    }
+    render_thread_.join();
+}
+
+template <typename State, typename Action, typename CostType>
+void SearchPlayer<State, Action, CostType>::RenderLoop() {
+    int frame_ms = 1000 / std::max<uint32_t>(options_.max_frames_per_second, 1);
+
+    for (;;) {
+        bool finished = false;
+        {
+            std::lock_guard<std::mutex> lock(control_mutex_);
+            finished = finished_;
+        }
+
+        // Only the rows that fit are built, under the view's lock
+        view_->Render(*ui_, kTreeWindow, kFrontierWindow);
+        frame_requested_ = true;
+        ui_->PrintToStatusBar(GetAutoPlayStatus());
+        ui_->RefreshAll();
+        if (finished) break;
+
+        // Waiting for a key is what caps the frame rate
+        int key = ui_->GetInput(frame_ms);
+        if (key != ERR) HandleKey(key);
+    }
+
+    bool stopped = false;
+    {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        stopped = stopped_;
+    }
+    if (!stopped) ui_->WaitForKey('\n');
+}
+
+template <typename State, typename Action, typename CostType>
+void SearchPlayer<State, Action, CostType>::HandleKey(int key) {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+    switch (key) {
+        case ' ':
+            paused_ = !paused_;
+            steps_ = 0;
+            break;
+        case 'n':
+            if (paused_) ++steps_;
+            break;
+        case '+':
+            delay_ms_ /= 2;
+            break;
+        case '-':
+            delay_ms_ = delay_ms_ ? std::min(delay_ms_ * 2, kMaxDelayMs) : 1;
+            break;
+        case 'q':
+            stopped_ = true;
+            break;
+        default:
+            return;
+    }
+    control_cv_.notify_all();
+}
+
+template <typename State, typename Action, typename CostType>
+std::string SearchPlayer<State, Action, CostType>::GetAutoPlayStatus() {
+    std::string status = "Nodes: " + std::to_string(view_->GetNumNodes()) +
+                         "  Frontier: " +
+                         std::to_string(view_->GetFrontierSize()) + "  ";
+
+    std::lock_guard<std::mutex> lock(control_mutex_);
+    if (stopped_) return status + "Stopped";
+    if (finished_) return status + "Finished, press Enter to exit";
+
+    status += paused_ ? "Paused" : "Running";
+    if (delay_ms_ > 0) status += ", " + std::to_string(delay_ms_) + " ms/step";
+    return status + "  [space] pause  [n] step  [+/-] speed  [q] quit";
+}
+
+}  // namespace visual_search
@@ -1,10 +1,11 @@
 #include <queue>
-#include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "data_structure/problem.h"
-#include "data_structure/visual/terminal_ui.h"
+#include "data_structure/state_hash.h"
 #include "data_structure/visual/visual_node.h"
+#include "search_player.h"
 #include "visual_search.h"
 
 using namespace visual_search;
@@ -16,19 +17,14 @@ template <typename State, typename Action, typename CostType,
           typename Comparator>
 std::shared_ptr<VisualNode<State, Action, CostType>>
 visual_search::VisualBestFirstSearch(
-    Problem<State, Action, CostType> const& problem) {
+    Problem<State, Action, CostType> const& problem,
+    const VisualOptions& options) {
     using NodeType = VisualNode<State, Action, CostType>;
     using NodePtrVector = std::vector<std::shared_ptr<NodeType>>;
 
-    int columns_layout = 2;
-    TerminalUI ui(columns_layout);
-    int left_window_index = 0;
-    int right_window_index = 1;
-
     State initialState = problem.GetInitialState();
-    std::string rootIndexStr = "0";
     std::shared_ptr<NodeType> root =
-        std::make_shared<NodeType>(rootIndexStr, initialState);
+        std::make_shared<NodeType>(0, initialState);
 
     // Create concrete comparator instance
     Comparator comparator(problem);
@@ -44,38 +40,36 @@ visual_search::VisualBestFirstSearch(
 
     frontier.push(root);
 
-    std::set<State> reached = std::set<State>();
+    // Shows the search as options.playback asks; the view is nullptr when
+    // headless
+    SearchPlayer<State, Action, CostType> player(problem, options);
+    SearchView<State, Action, CostType>* view = player.GetView();
+    if (view) {
+        view->AddNode(*root);
+        view->PushFrontier(*root);
+    }
+
+    std::unordered_set<State, StateHash<State>> reached;
     reached.insert(root->GetState());
 
     // Increase depth limit until solution is found
     while (!frontier.empty()) {
-        
-
-        /*
-         * Print Tree
-         */
-        ui.RefreshAll();
-        ui.PrintToWindow(left_window_index, 0, 0,
-                         "Tree:\n" + root->GetTreeString());
-        ui.PrintToWindow(
-            right_window_index, 0, 0,
-            "Frontier States:\n" + root->GetFrontierStatesString(problem));
-        ui.PrintToStatusBar("Press Enter to continue...");
-        ui.RefreshAll();
-
-        ui.WaitForKey('\n');
+        if (!player.NextStep()) return nullptr;  // Stopped by the user
 
         std::shared_ptr<NodeType> node = frontier.top();
         frontier.pop();
+        if (view) view->PopFrontier(*node);
 
         if (problem.IsGoal(node->GetState())) return node;
 
         NodePtrVector children = node->Expand(
             const_cast<Problem<State, Action, CostType>&>(problem));
         for (const auto& child : children) {
+            if (view) view->AddNode(*child);
             if (reached.find(child->GetState()) == reached.end()) {
                 reached.insert(child->GetState());
                 frontier.push(child);
+                if (view) view->PushFrontier(*child);
             }
         }
     }
@@ -1,11 +1,12 @@
 #include <limits>
 #include <queue>
-#include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "data_structure/node.h"
 #include "data_structure/problem.h"
-#include "data_structure/visual/terminal_ui.h"
+#include "data_structure/state_hash.h"
+#include "search_player.h"
 #include "visual_search.h"
 
 using namespace visual_search;
@@ -17,17 +18,13 @@ using namespace visual_search;
 template <typename State, typename Action, typename CostType>
 std::shared_ptr<VisualNode<State, Action, CostType>>
 visual_search::VisualBreadthFirstSearch(
-    Problem<State, Action, CostType> const& problem) {
+    Problem<State, Action, CostType> const& problem,
+    const VisualOptions& options) {
     using NodeType = VisualNode<State, Action, CostType>;
 
-    int columns_layout = 2;
-    TerminalUI ui = TerminalUI(columns_layout);
-    int left_window_index = 0;
-    int right_window_index = 1;
-
     State initialState = problem.GetInitialState();
     std::shared_ptr<NodeType> root =
-        std::make_shared<NodeType>("0", initialState);
+        std::make_shared<NodeType>(0, initialState);
 
     if (problem.IsGoal(root->GetState())) return root;
 
@@ -35,36 +32,34 @@ visual_search::VisualBreadthFirstSearch(
         std::queue<std::shared_ptr<NodeType>>();
     fifo_queue.push(root);
 
-    std::set<State> reached = std::set<State>();
+    // Shows the search as options.playback asks; the view is nullptr when
+    // headless
+    SearchPlayer<State, Action, CostType> player(problem, options);
+    SearchView<State, Action, CostType>* view = player.GetView();
+    if (view) {
+        view->AddNode(*root);
+        view->PushFrontier(*root);
+    }
+
+    std::unordered_set<State, StateHash<State>> reached;
     reached.insert(root->GetState());
     while (!fifo_queue.empty()) {
-        /*
-         * Print Tree
-         */
-        ui.RefreshAll();
-        ui.PrintToWindow(left_window_index, 0, 0,
-                         "Tree:\n" + root->GetTreeString());
-        ui.PrintToWindow(
-            right_window_index, 0, 0,
-            "Frontier States:\n" + root->GetFrontierStatesString(problem));
-        ui.PrintToStatusBar("Press Enter to continue...");
-        ui.RefreshAll();
-
-        // Wait for user input to proceed
-        // std::cout << "Press Enter to continue..." << std::endl;
-        ui.WaitForKey('\n');
+        if (!player.NextStep()) return nullptr;  // Stopped by the user
 
         std::shared_ptr<NodeType> node = fifo_queue.front();
         fifo_queue.pop();
+        if (view) view->PopFrontier(*node);
 
         std::vector<std::shared_ptr<NodeType>> children = node->Expand(
             const_cast<Problem<State, Action, CostType>&>(problem));
 
         for (const auto& child : children) {
             if (problem.IsGoal(child->GetState())) return child;
+            if (view) view->AddNode(*child);
             if (reached.find(child->GetState()) == reached.end()) {
                 reached.insert(child->GetState());
                 fifo_queue.push(child);
+                if (view) view->PushFrontier(*child);
             }
         }
     }
@@ -0,0 +1,48 @@
+/**
+ * @file visual_options.h
+ * @brief Optional settings of the visual searches
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_ALGORITHMS_VISUAL_VISUAL_OPTIONS_H_
+#define SEARCH_ALG_ALGORITHMS_VISUAL_VISUAL_OPTIONS_H_
+
+#include <cstdint>
+
+namespace visual_search {
+
+/**
+ * @brief How a visual search is shown
+ */
+enum class PlaybackMode {
+    kStep,      ///< Redraw and wait for Enter before every expansion
+    kAutoPlay,  ///< Search freely, a render thread draws at a capped rate
+    kHeadless,  ///< Search without drawing anything
+};
+
+/**
+ * @brief Optional settings of a visual search run
+ *
+ * A default-constructed VisualOptions shows the search like before the
+ * options existed.
+ */
+struct VisualOptions {
+    /// List only the open nodes (frontier nodes and their ancestors) in the
+    /// tree panel, collapsing finished subtrees into the per-depth counts
+    bool collapse_closed_subtrees = false;
+
+    /// Stepping, auto-play or headless
+    PlaybackMode playback = PlaybackMode::kStep;
+
+    /// Auto-play: most frames drawn per second
+    uint32_t max_frames_per_second = 30;
+
+    /// Auto-play: initial pause between expansions in milliseconds, 0 for
+    /// full speed; changed at run time with '+' and '-'
+    uint32_t expansion_delay_ms = 0;
+};
+
+}  // namespace visual_search
+
+#endif  // SEARCH_ALG_ALGORITHMS_VISUAL_VISUAL_OPTIONS_H_
@@ -17,6 +17,7 @@
 #include "data_structure/problem.h"
 #include "data_structure/problems/sliding_tile_problem.h"
 #include "data_structure/visual/visual_node.h"
+#include "visual_options.h"
 
 /**
  * @namespace visual_search
@@ -52,6 +53,7 @@ namespace visual_search {
  *
  * @param problem The problem instance defining initial state, goal test, and
  * available actions
+ * @param options Display settings
  *
  * @return std::shared_ptr<VisualNode<State, Action, CostType>>
  *         Shared pointer to the goal node if found, nullptr if no solution
@@ -59,20 +61,24 @@ namespace visual_search {
  *
  * @note This function uses a set to track reached states and avoid redundant
  * paths
- * @note The search process is interactive - user must press Enter to continue
- * between steps
+ * @note By default the search process is interactive - user must press Enter
+ * to continue between steps; options.playback selects auto-play or headless
+ * runs, and the search returns nullptr if the user stops it
  *
  * @see Node::Expand() for details on how child nodes are generated
- * @see VisualNode::PrintTree() for tree visualization format
+ * @see SearchView for the tree and frontier panels
+ * @see SearchPlayer for the playback modes and controls
  */
 template <typename State, typename Action, typename CostType>
 std::shared_ptr<VisualNode<State, Action, CostType>> VisualBreadthFirstSearch(
-    Problem<State, Action, CostType> const& problem);
+    Problem<State, Action, CostType> const& problem,
+    const VisualOptions& options = VisualOptions());
 
 template <typename State, typename Action, typename CostType,
           typename Comparator>
 std::shared_ptr<VisualNode<State, Action, CostType>> VisualBestFirstSearch(
-    Problem<State, Action, CostType> const& problem);
+    Problem<State, Action, CostType> const& problem,
+    const VisualOptions& options = VisualOptions());
 }  // namespace visual_search
 
 // Include template implementation
@@ -0,0 +1,137 @@
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/chess_board_problem.h"
+
+// Runs A* on chess preset 2 without snapshots, with snapshots written in a
+// forked child and with snapshots written inline, then resumes from the last
+// snapshot and checks the resumed run ends exactly like the original one.
+// The longest pause between two expansions shows what a snapshot costs the
+// search; on a single core the forked writer still competes for the CPU, so
+// total time only improves with a spare core.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using chess_board::Action;
+using chess_board::ChessCostType;
+using chess_board::State;
+using Comparator = CompareByAStar<State, Action, ChessCostType>;
+using ChessNode = Node<State, Action, ChessCostType>;
+
+// Records the longest gap between two expansions, i.e. the longest pause
+class PauseTrackingProblem : public chess_board::ChessBoardProblem {
+   public:
+    using ChessBoardProblem::ChessBoardProblem;
+
+    std::vector<Action> GetActions(const State& state) const override {
+        Clock::time_point now = Clock::now();
+        if (last_ != Clock::time_point())
+            longest_pause_ = std::max(longest_pause_, now - last_);
+        last_ = now;
+        return ChessBoardProblem::GetActions(state);
+    }
+
+    double TakeLongestPauseMs() {
+        double ms =
+            std::chrono::duration<double, std::milli>(longest_pause_).count();
+        longest_pause_ = Clock::duration::zero();
+        last_ = Clock::time_point();
+        return ms;
+    }
+
+   private:
+    mutable Clock::time_point last_;
+    mutable Clock::duration longest_pause_ = Clock::duration::zero();
+};
+
+struct Run {
+    std::shared_ptr<ChessNode> solution;
+    search_algorithm::SearchStatistics statistics;
+    double ms = 0;
+    double longest_pause_ms = 0;
+};
+
+Run RunAStar(PauseTrackingProblem& problem,
+             search_algorithm::SearchOptions options) {
+    Run run;
+    options.statistics = &run.statistics;
+
+    Clock::time_point start = Clock::now();
+    run.solution = search_algorithm::BestFirstSearch<State, Action,
+                                                     ChessCostType, Comparator>(
+        problem, options);
+    run.ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    run.longest_pause_ms = problem.TakeLongestPauseMs();
+    return run;
+}
+
+void Print(const std::string& name, const Run& run) {
+    std::cout << std::left << std::setw(22) << name << std::right
+              << "  expanded " << std::setw(8) << run.statistics.expanded
+              << "  generated " << std::setw(9) << run.statistics.generated
+              << "  cost " << std::setw(4)
+              << (run.solution ? run.solution->GetPathCost() : -1.0f)
+              << "  time " << std::fixed << std::setprecision(1)
+              << std::setw(8) << run.ms << " ms  longest pause "
+              << std::setw(7) << run.longest_pause_ms << " ms" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    const std::string path = "/tmp/chess_a_star.checkpoint";
+    const uint64_t interval = 20000;
+    PauseTrackingProblem problem(2);
+
+    Run plain = RunAStar(problem, search_algorithm::SearchOptions());
+    Print("no snapshots", plain);
+
+    search_algorithm::SearchOptions options;
+    options.checkpoint_path = path;
+    options.checkpoint_interval = interval;
+
+    options.checkpoint_in_background = false;
+    Print("inline snapshots", RunAStar(problem, options));
+
+    options.checkpoint_in_background = true;
+    Print("forked snapshots", RunAStar(problem, options));
+
+    struct stat file_stat {};
+    if (stat(path.c_str(), &file_stat) != 0) {
+        std::cout << "No snapshot written" << std::endl;
+        return 1;
+    }
+    std::cout << "snapshot every " << interval << " expansions, last one "
+              << file_stat.st_size / 1024 << " KiB" << std::endl;
+
+    search_algorithm::SearchOptions resume;
+    resume.resume_path = path;
+    Run resumed = RunAStar(problem, resume);
+    Print("resumed", resumed);
+
+    bool same = resumed.solution && plain.solution &&
+                resumed.statistics.expanded == plain.statistics.expanded &&
+                resumed.statistics.generated == plain.statistics.generated &&
+                resumed.solution->GetState() == plain.solution->GetState() &&
+                resumed.solution->GetPathCost() ==
+                    plain.solution->GetPathCost();
+    std::cout << (same ? "resumed run matches the original"
+                       : "MISMATCH between resumed and original run")
+              << std::endl;
+
+    std::remove(path.c_str());
+    return same ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/state_hash.h"
+
+// Times the chess problem's per-state work in isolation: GetActions,
+// GetResult of every action and Heuristic, over the first states a
+// breadth-first walk from each preset's initial state reaches
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using chess_board::Action;
+using chess_board::ChessBoardProblem;
+using chess_board::State;
+
+constexpr std::size_t kNumStates = 100000;
+constexpr int kRounds = 5;
+
+std::vector<State> CollectStates(const ChessBoardProblem& problem) {
+    std::vector<State> states = {problem.GetInitialState()};
+    std::unordered_set<State, StateHash<State>> seen(states.begin(),
+                                                     states.end());
+    for (std::size_t i = 0; i < states.size() && states.size() < kNumStates;
+         ++i) {
+        for (const Action& action : problem.GetActions(states[i])) {
+            State next = *problem.GetResult(states[i], action);
+            if (seen.insert(next).second) states.push_back(std::move(next));
+        }
+    }
+    return states;
+}
+
+template <typename Work>
+double BestOf(Work work, uint64_t* out_checksum) {
+    double best = 1e300;
+    for (int round = 0; round < kRounds; ++round) {
+        *out_checksum = 0;
+        Clock::time_point start = Clock::now();
+        work(out_checksum);
+        best = std::min(best, std::chrono::duration<double, std::milli>(
+                                  Clock::now() - start)
+                                  .count());
+    }
+    return best;
+}
+
+void Measure(int preset) {
+    ChessBoardProblem problem(preset);
+    std::vector<State> states = CollectStates(problem);
+
+    uint64_t actions = 0, results = 0, heuristic = 0;
+    double actions_ms = BestOf(
+        [&](uint64_t* sum) {
+            for (const State& state : states)
+                *sum += problem.GetActions(state).size();
+        },
+        &actions);
+    double results_ms = BestOf(
+        [&](uint64_t* sum) {
+            for (const State& state : states)
+                for (const Action& action : problem.GetActions(state))
+                    *sum ^= problem.GetResult(state, action)->GetHash();
+        },
+        &results);
+    double heuristic_ms = BestOf(
+        [&](uint64_t* sum) {
+            for (const State& state : states)
+                *sum += static_cast<uint64_t>(problem.Heuristic(state));
+        },
+        &heuristic);
+
+    std::cout << "Chess preset " << preset << ", " << states.size()
+              << " states, " << actions << " actions" << std::endl
+              << std::fixed << std::setprecision(2)
+              << "  GetActions            " << std::setw(8) << actions_ms
+              << " ms" << std::endl
+              << "  GetActions+GetResult  " << std::setw(8) << results_ms
+              << " ms  (checksum " << std::hex << results << std::dec << ")"
+              << std::endl
+              << "  Heuristic             " << std::setw(8) << heuristic_ms
+              << " ms  (sum " << heuristic << ")" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    Measure(1);
+    Measure(2);
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/fingerprint_set.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/problems/sliding_tile_problem.h"
+
+// Compares breadth-first search keeping full states in the reached set with
+// keeping 64-bit fingerprints (SearchOptions::fingerprint_reached), with and
+// without a Bloom filter, by reached set memory, time and collisions: a
+// fingerprint collision drops a new state, so it shows up as a smaller
+// reached count than the exact run. Then times FingerprintSet alone on
+// lookups of absent fingerprints, where the Bloom filter answers most.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Never reaches its goal, so BFS enumerates all 9!/2 reachable boards
+class ExhaustiveTileProblem : public sliding_tile::SlidingTileProblem {
+   public:
+    using SlidingTileProblem::SlidingTileProblem;
+
+    bool IsGoal(const sliding_tile::State&) const override { return false; }
+};
+
+struct Mode {
+    const char* name;
+    bool fingerprints;
+    std::size_t bloom_bits_per_state;
+};
+
+const Mode kModes[] = {
+    {"exact", false, 0}, {"fingerprint", true, 0}, {"fp+bloom8", true, 8}};
+
+template <typename State, typename Action, typename Cost>
+void Compare(const std::string& name,
+             const Problem<State, Action, Cost>& problem) {
+    uint64_t exact_reached = 0;
+    for (const Mode& mode : kModes) {
+        search_algorithm::SearchStatistics statistics;
+        search_algorithm::SearchOptions options;
+        options.statistics = &statistics;
+        options.fingerprint_reached = mode.fingerprints;
+        options.bloom_bits_per_state = mode.bloom_bits_per_state;
+
+        Clock::time_point start = Clock::now();
+        auto solution = search_algorithm::BreadthFirstSearch(problem, options);
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() -
+                                                              start)
+                        .count();
+        if (!mode.fingerprints) exact_reached = statistics.reached;
+
+        std::cout << "  " << std::left << std::setw(10) << name << " "
+                  << std::setw(11) << mode.name << std::right << "  depth "
+                  << std::setw(3) << (solution ? solution->GetDepth() : 0)
+                  << "  reached " << std::setw(8) << statistics.reached
+                  << "  " << std::fixed << std::setprecision(1)
+                  << std::setw(7) << statistics.reached_bytes / 1048576.0
+                  << " MiB (" << std::setw(5)
+                  << static_cast<double>(statistics.reached_bytes) /
+                         statistics.reached
+                  << " B/state)  collisions " << std::setw(2)
+                  << exact_reached - statistics.reached << "  time "
+                  << std::setprecision(2) << std::setw(8) << ms << " ms"
+                  << std::endl;
+    }
+    // Birthday bound for 64-bit fingerprints of distinct hashes
+    std::cout << "  " << std::left << std::setw(10) << name << std::right
+              << " expected collisions " << std::scientific
+              << std::setprecision(1)
+              << std::pow(static_cast<double>(exact_reached), 2) /
+                     std::pow(2.0, 65)
+              << std::defaultfloat << std::endl;
+}
+
+// Inserts random fingerprints, then looks up as many absent ones
+void CompareLookups(std::size_t num_keys, std::size_t bloom_bits_per_state) {
+    std::mt19937_64 rng(1);
+    FingerprintSet set(bloom_bits_per_state);
+    for (std::size_t i = 0; i < num_keys; ++i) set.Insert(rng());
+    uint64_t rejections_after_inserts = set.GetBloomRejections();
+
+    uint64_t found = 0;
+    Clock::time_point start = Clock::now();
+    for (std::size_t i = 0; i < num_keys; ++i) found += set.Contains(rng());
+    double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::cout << "  " << num_keys << " absent lookups, bloom bits/state "
+              << bloom_bits_per_state << ": " << std::fixed
+              << std::setprecision(2) << ms << " ms, "
+              << std::setprecision(1)
+              << 100.0 *
+                     (set.GetBloomRejections() - rejections_after_inserts) /
+                     num_keys
+              << "% answered by the filter, " << found << " found, "
+              << set.GetMemoryBytes() / 1048576.0 << " MiB" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "Breadth-first search reached sets" << std::endl;
+    Compare("tile 3x3", ExhaustiveTileProblem(3));
+    Compare("chess 1", chess_board::ChessBoardProblem(1));
+    Compare("chess 2", chess_board::ChessBoardProblem(2));
+
+    std::cout << "FingerprintSet lookups" << std::endl;
+    for (std::size_t bits : {0, 8, 12}) CompareLookups(4000000, bits);
+    return 0;
+}
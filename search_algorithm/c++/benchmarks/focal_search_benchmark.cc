@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/problems/fixed_sliding_tile_problem.h"
+#include "data_structure/problems/sliding_tile_generator.h"
+
+// Compares focal search at several weights with A* (focal search at weight
+// 1) on hard 15-puzzle instances, by expansions, time and solution cost
+// relative to the optimum, with the default focal key g + weight * h and
+// with the distance-to-go key h
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Puzzle = sliding_tile::FixedSlidingTileProblem<4>;
+using sliding_tile::Action;
+using sliding_tile::CostType;
+using PuzzleState = Puzzle::StateType;
+using FocalKey = std::function<double(const Node<PuzzleState, Action,
+                                                 CostType>&)>;
+
+struct Result {
+    uint64_t cost = 0;
+    uint64_t expanded = 0;
+    double ms = 0;
+};
+
+Result Solve(const Puzzle& puzzle, double weight, const FocalKey& key) {
+    search_algorithm::SearchStatistics statistics;
+    search_algorithm::SearchOptions options;
+    options.statistics = &statistics;
+
+    Clock::time_point start = Clock::now();
+    auto solution = search_algorithm::FocalSearch<PuzzleState, Action,
+                                                  CostType>(puzzle, weight,
+                                                            options, key);
+    Result result;
+    result.ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    result.cost = solution ? solution->GetPathCost() : 0;
+    result.expanded = statistics.expanded;
+    return result;
+}
+
+// Makes the focal key for one puzzle; nullptr keys use the default
+using KeyFactory = std::function<FocalKey(const Puzzle&)>;
+
+// Runs every puzzle and prints the totals; fills optimal on the first call
+void Compare(const std::string& name, const std::vector<Puzzle>& puzzles,
+             double weight, const KeyFactory& make_key,
+             std::vector<uint64_t>* optimal) {
+    Result total;
+    double worst_ratio = 0;
+    for (std::size_t i = 0; i < puzzles.size(); ++i) {
+        Result result = Solve(puzzles[i], weight, make_key(puzzles[i]));
+        if (optimal->size() <= i) optimal->push_back(result.cost);
+        worst_ratio = std::max(worst_ratio, static_cast<double>(result.cost) /
+                                                (*optimal)[i]);
+        total.cost += result.cost;
+        total.expanded += result.expanded;
+        total.ms += result.ms;
+    }
+    std::cout << "  " << std::left << std::setw(9) << name << std::right
+              << "  weight " << std::fixed << std::setprecision(2)
+              << std::setw(4) << weight << "  total cost " << std::setw(4)
+              << total.cost << "  worst cost/optimal " << worst_ratio
+              << "  expanded " << std::setw(9) << total.expanded << "  time "
+              << std::setprecision(1) << std::setw(8) << total.ms << " ms"
+              << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    sliding_tile::InstanceGenerator generator(4, 49);
+    std::vector<Puzzle> puzzles;
+    for (const sliding_tile::State& board : generator.RandomWalks(6, 60, 80))
+        puzzles.emplace_back(board);
+
+    std::vector<uint64_t> optimal;
+    KeyFactory weighted_f = [](const Puzzle&) { return FocalKey(); };
+    KeyFactory distance_to_go = [](const Puzzle& puzzle) {
+        return FocalKey(
+            [&puzzle](const Node<PuzzleState, Action, CostType>& node) {
+                return static_cast<double>(puzzle.Heuristic(node.GetState()));
+            });
+    };
+
+    // Weight 1 is A* and gives the optimal costs
+    for (double weight : {1.0, 1.1, 1.25, 1.5, 2.0})
+        Compare("g + w * h", puzzles, weight, weighted_f, &optimal);
+    for (double weight : {1.25, 1.5, 2.0})
+        Compare("h", puzzles, weight, distance_to_go, &optimal);
+    return 0;
+}
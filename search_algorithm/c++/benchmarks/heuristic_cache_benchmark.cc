@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/cached_heuristic_problem.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/problems/sliding_tile_problem.h"
+
+// Compares A* and parallel IDA* on a problem against the same problem
+// wrapped in CachedHeuristicProblem, by time and cache hit rate. A* asks for
+// both heuristics of every comparison and IDA* re-evaluates the states of
+// earlier iterations, so both repeat heuristic calls on the same states.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kCacheEntries = 1 << 20;
+
+template <typename Solve>
+void Time(const std::string& name, Solve solve) {
+    Clock::time_point start = Clock::now();
+    auto solution = solve();
+    double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::cout << "  " << std::left << std::setw(30) << name << std::right
+              << "  depth " << std::setw(3)
+              << (solution ? solution->GetDepth() : 0) << "  time "
+              << std::fixed << std::setprecision(2) << std::setw(9) << ms
+              << " ms" << std::endl;
+}
+
+template <typename State, typename Action, typename Cost>
+void PrintHitRate(const CachedHeuristicProblem<State, Action, Cost>& cached) {
+    std::cout << "    hit rate " << std::fixed << std::setprecision(1)
+              << 100 * cached.GetHitRate() << "% of "
+              << cached.GetHits() + cached.GetMisses() << " calls"
+              << std::endl;
+}
+
+template <typename State, typename Action, typename Cost>
+void Compare(const std::string& name,
+             const Problem<State, Action, Cost>& problem) {
+    using Comparator = CompareByAStar<State, Action, Cost>;
+    CachedHeuristicProblem<State, Action, Cost> cached(problem, kCacheEntries);
+
+    Time(name + " A*", [&] {
+        return search_algorithm::BestFirstSearch<State, Action, Cost,
+                                                 Comparator>(problem);
+    });
+    Time(name + " A* cached", [&] {
+        return search_algorithm::BestFirstSearch<State, Action, Cost,
+                                                 Comparator>(cached);
+    });
+    PrintHitRate(cached);
+
+    for (std::size_t threads : {1, 4}) {
+        search_algorithm::SearchOptions options;
+        options.num_threads = threads;
+        std::string suffix = " IDA* x" + std::to_string(threads);
+        Time(name + suffix, [&] {
+            return search_algorithm::ParallelIDAStarSearch(problem, options);
+        });
+        cached.Clear();
+        Time(name + suffix + " cached", [&] {
+            return search_algorithm::ParallelIDAStarSearch(cached, options);
+        });
+        PrintHitRate(cached);
+    }
+}
+
+}  // namespace
+
+int main() {
+    Compare("chess 1", chess_board::ChessBoardProblem(1));
+    Compare("chess 2", chess_board::ChessBoardProblem(2));
+
+    // A hard 3x3 instance for the usual goal
+    sliding_tile::State tiles = {{8, 6, 7}, {2, 5, 4}, {3, 0, 1}};
+    Compare("tile 3x3", sliding_tile::SlidingTileProblem(tiles, 3));
+    return 0;
+}
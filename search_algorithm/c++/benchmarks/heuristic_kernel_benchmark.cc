@@ -0,0 +1,136 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "data_structure/problems/sliding_tile_kernels.h"
+
+// Measures the sliding tile heuristic kernels for every instruction set the
+// CPU supports, single board and batched, against a division/modulo
+// reference, and checks that all of them agree
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using sliding_tile::HeuristicKernel;
+using sliding_tile::KernelIsa;
+
+constexpr int kRepetitions = 20;
+
+// Random permutations; solvability does not matter for the heuristic
+std::vector<uint8_t> MakeBoards(std::size_t dimension, std::size_t count) {
+    std::mt19937 rng(7);
+    std::size_t cells = dimension * dimension;
+    std::vector<uint8_t> boards(cells * count);
+    for (std::size_t b = 0; b < count; ++b) {
+        uint8_t* board = boards.data() + b * cells;
+        for (std::size_t i = 0; i < cells; ++i)
+            board[i] = static_cast<uint8_t>(i);
+        for (std::size_t i = cells - 1; i > 0; --i)
+            std::swap(board[i], board[rng() % (i + 1)]);
+    }
+    return boards;
+}
+
+// The per-tile arithmetic SlidingTileProblem used before the kernels
+int ReferenceManhattan(const uint8_t* board, std::size_t dimension) {
+    int total = 0;
+    for (std::size_t cell = 0; cell < dimension * dimension; ++cell) {
+        if (board[cell] == 0) continue;
+        int row = static_cast<int>(cell / dimension);
+        int col = static_cast<int>(cell % dimension);
+        int goal_row = static_cast<int>(board[cell] / dimension);
+        int goal_col = static_cast<int>(board[cell] % dimension);
+        total += std::abs(row - goal_row) + std::abs(col - goal_col);
+    }
+    return total;
+}
+
+template <typename Function>
+double NanosecondsPerBoard(std::size_t count, Function function) {
+    Clock::time_point start = Clock::now();
+    for (int rep = 0; rep < kRepetitions; ++rep) function();
+    double total =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return total / (static_cast<double>(count) * kRepetitions);
+}
+
+void RunBenchmark(std::size_t dimension, std::size_t count) {
+    std::size_t cells = dimension * dimension;
+    std::vector<uint8_t> boards = MakeBoards(dimension, count);
+    std::vector<int> out(count);
+    volatile int sink = 0;
+
+    std::vector<int> reference(count);
+    for (std::size_t b = 0; b < count; ++b)
+        reference[b] = ReferenceManhattan(boards.data() + b * cells, dimension);
+
+    double reference_ns = NanosecondsPerBoard(count, [&]() {
+        for (std::size_t b = 0; b < count; ++b)
+            sink = sink + ReferenceManhattan(boards.data() + b * cells,
+                                             dimension);
+    });
+    std::cout << dimension << "x" << dimension << "  div/mod reference "
+              << std::fixed << std::setprecision(2) << std::setw(8)
+              << reference_ns << " ns" << std::endl;
+
+    HeuristicKernel scalar(dimension, KernelIsa::kScalar);
+    std::vector<int> scalar_conflicts(count);
+    for (std::size_t b = 0; b < count; ++b)
+        scalar_conflicts[b] = scalar.Conflicts(boards.data() + b * cells);
+
+    for (KernelIsa isa :
+         {KernelIsa::kScalar, KernelIsa::kSse41, KernelIsa::kAvx2}) {
+        HeuristicKernel kernel(dimension, isa);
+        if (kernel.GetIsa() != isa) continue;  // Not supported here
+
+        bool agree = true;
+        for (std::size_t b = 0; b < count; ++b) {
+            const uint8_t* board = boards.data() + b * cells;
+            agree = agree && kernel.Manhattan(board) == reference[b] &&
+                    kernel.Conflicts(board) == scalar_conflicts[b];
+        }
+
+        double manhattan_ns = NanosecondsPerBoard(count, [&]() {
+            for (std::size_t b = 0; b < count; ++b)
+                sink = sink + kernel.Manhattan(boards.data() + b * cells);
+        });
+        double conflicts_ns = NanosecondsPerBoard(count, [&]() {
+            for (std::size_t b = 0; b < count; ++b)
+                sink = sink +
+                       kernel.ManhattanConflicts(boards.data() + b * cells);
+        });
+        double batch_ns = NanosecondsPerBoard(count, [&]() {
+            kernel.EvaluateBatch(boards.data(), count, false, out.data());
+        });
+        double batch_conflicts_ns = NanosecondsPerBoard(count, [&]() {
+            kernel.EvaluateBatch(boards.data(), count, true, out.data());
+        });
+
+        std::cout << "     " << std::setw(7)
+                  << sliding_tile::KernelIsaName(isa) << "  manhattan "
+                  << std::setw(6) << manhattan_ns << " ns"
+                  << "  +conflicts " << std::setw(6) << conflicts_ns << " ns"
+                  << "  batch " << std::setw(6) << batch_ns << " ns"
+                  << "  batch+conflicts " << std::setw(6)
+                  << batch_conflicts_ns << " ns"
+                  << (agree ? "" : "  MISMATCH") << std::endl;
+    }
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "Heuristic kernels, time per board (CPU best: "
+              << sliding_tile::KernelIsaName(sliding_tile::DetectKernelIsa())
+              << ")" << std::endl;
+
+    RunBenchmark(3, 100000);
+    RunBenchmark(4, 100000);
+    RunBenchmark(5, 100000);
+
+    return 0;
+}
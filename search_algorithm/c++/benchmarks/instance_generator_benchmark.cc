@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/fixed_sliding_tile_problem.h"
+#include "data_structure/problems/sliding_tile_generator.h"
+
+// Times uniform solvable board generation for odd and even dimensions, then
+// draws random-walk instances in bands of walk lengths and solves them with
+// A* to show how the optimal solution lengths follow the bands
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using sliding_tile::InstanceGenerator;
+
+constexpr uint64_t kSeed = 2025;
+
+void TimeUniform(uint64_t dimension, std::size_t count) {
+    InstanceGenerator generator(dimension, kSeed);
+    uint64_t checksum = 0;
+    Clock::time_point start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i)
+        checksum += generator.RandomSolvable()[0][0];
+    double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::cout << "  " << dimension << "x" << dimension << "  " << count
+              << " boards  " << std::fixed << std::setprecision(2)
+              << std::setw(8) << ms << " ms  " << std::setw(7)
+              << 1e6 * ms / count << " ns/board  (checksum " << checksum
+              << ")" << std::endl;
+}
+
+template <uint64_t N>
+void SolveBand(uint64_t min_moves, uint64_t max_moves, std::size_t count) {
+    using Puzzle = sliding_tile::FixedSlidingTileProblem<N>;
+    using Comparator = CompareByAStar<typename Puzzle::StateType,
+                                      sliding_tile::Action,
+                                      sliding_tile::CostType, Puzzle>;
+
+    InstanceGenerator generator(N, kSeed);
+    std::vector<uint64_t> depths;
+    Clock::time_point start = Clock::now();
+    for (const sliding_tile::State& board :
+         generator.RandomWalks(count, min_moves, max_moves)) {
+        Puzzle puzzle(board);
+        auto solution = search_algorithm::BestFirstSearch<
+            typename Puzzle::StateType, sliding_tile::Action,
+            sliding_tile::CostType, Comparator>(puzzle);
+        depths.push_back(solution ? solution->GetDepth() : 0);
+    }
+    double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    double mean = 0;
+    for (uint64_t depth : depths) mean += depth;
+    mean /= depths.size();
+    std::cout << "  " << N << "x" << N << "  walks " << std::setw(2)
+              << min_moves << "-" << std::setw(2) << max_moves
+              << "  optimal depth min " << std::setw(2)
+              << *std::min_element(depths.begin(), depths.end()) << " mean "
+              << std::fixed << std::setprecision(1) << std::setw(4) << mean
+              << " max " << std::setw(2)
+              << *std::max_element(depths.begin(), depths.end())
+              << "  solved in " << std::setprecision(0) << ms << " ms"
+              << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "Uniform solvable boards" << std::endl;
+    for (uint64_t dimension = 2; dimension <= 8; ++dimension)
+        TimeUniform(dimension, 100000);
+
+    std::cout << "Random-walk bands, " << 20 << " instances each"
+              << std::endl;
+    for (uint64_t band = 0; band < 4; ++band)
+        SolveBand<3>(10 * band + 1, 10 * band + 10, 20);
+    for (uint64_t band = 0; band < 5; ++band)
+        SolveBand<4>(10 * band + 1, 10 * band + 10, 20);
+    return 0;
+}
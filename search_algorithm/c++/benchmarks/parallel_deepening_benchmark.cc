@@ -0,0 +1,105 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/problems/fixed_sliding_tile_problem.h"
+
+// Compares sequential iterative deepening with the parallel IDS and IDA* at
+// several thread counts, on chess preset 1 and scrambled 15-puzzles
+//
+// Usage: parallel_deepening_benchmark [max threads]
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Puzzle = sliding_tile::FixedSlidingTileProblem<4>;
+
+struct Result {
+    uint64_t expanded = 0;
+    uint64_t depth = 0;
+    double ms = 0;
+};
+
+template <typename Search>
+Result Run(Search search) {
+    search_algorithm::SearchStatistics statistics;
+    Clock::time_point start = Clock::now();
+    auto solution = search(&statistics);
+
+    Result result;
+    result.ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    result.expanded = statistics.expanded;
+    if (solution) result.depth = solution->GetDepth();
+    return result;
+}
+
+void Print(const std::string& name, const Result& result) {
+    std::cout << "  " << std::left << std::setw(18) << name << std::right
+              << "  depth " << std::setw(3) << result.depth << "  expanded "
+              << std::setw(10) << result.expanded << "  time " << std::fixed
+              << std::setprecision(2) << std::setw(9) << result.ms << " ms"
+              << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t max_threads =
+        argc > 1 ? std::stoul(argv[1])
+                 : std::max(4u, std::thread::hardware_concurrency());
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+              << std::endl;
+
+    std::cout << "chess preset 1, iterative deepening" << std::endl;
+    chess_board::ChessBoardProblem chess(1);
+    Print("sequential", Run([&](search_algorithm::SearchStatistics* stats) {
+              search_algorithm::SearchOptions options;
+              options.statistics = stats;
+              return search_algorithm::IterativeDeepeningSearch(chess, options);
+          }));
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        Print("parallel x" + std::to_string(threads),
+              Run([&](search_algorithm::SearchStatistics* stats) {
+                  search_algorithm::SearchOptions options;
+                  options.statistics = stats;
+                  options.num_threads = threads;
+                  return search_algorithm::ParallelIterativeDeepeningSearch(
+                      chess, options);
+              }));
+    }
+
+    // 15-puzzles scrambled by random walks, solved with IDA*
+    std::mt19937 rng(42);
+    Puzzle scrambler(Puzzle::GetGoalState());
+    for (int instance = 0; instance < 3; ++instance) {
+        Puzzle::StateType state = Puzzle::GetGoalState();
+        for (int step = 0; step < 80; ++step) {
+            auto actions = scrambler.GetActions(state);
+            state = *scrambler.GetResult(state, actions[rng() % actions.size()]);
+        }
+
+        std::cout << "15-puzzle instance " << instance << ", IDA*"
+                  << std::endl;
+        Puzzle puzzle(state);
+        for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+            Print("parallel x" + std::to_string(threads),
+                  Run([&](search_algorithm::SearchStatistics* stats) {
+                      search_algorithm::SearchOptions options;
+                      options.statistics = stats;
+                      options.num_threads = threads;
+                      return search_algorithm::ParallelIDAStarSearch(puzzle,
+                                                                     options);
+                  }));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/fixed_sliding_tile_problem.h"
+#include "data_structure/problems/sliding_tile_problem.h"
+
+// Compares A* on the runtime-dimension SlidingTileProblem against the
+// compile-time FixedSlidingTileProblem<N> on the same instances
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Scrambles the goal with a random walk so every instance is solvable and
+// both problem versions receive exactly the same boards
+std::vector<sliding_tile::State> MakeInstances(uint64_t dimension,
+                                               int num_instances,
+                                               int walk_length,
+                                               uint32_t seed) {
+    std::mt19937 rng(seed);
+    sliding_tile::SlidingTileProblem problem(
+        sliding_tile::State(dimension, std::vector<uint64_t>(dimension, 0)),
+        dimension);
+
+    std::vector<sliding_tile::State> instances;
+    for (int i = 0; i < num_instances; ++i) {
+        sliding_tile::State state = problem.GetGoalState();
+        for (int step = 0; step < walk_length; ++step) {
+            std::vector<sliding_tile::Action> actions =
+                problem.GetActions(state);
+            state = *problem.GetResult(state, actions[rng() % actions.size()]);
+        }
+        instances.push_back(state);
+    }
+    return instances;
+}
+
+template <typename TState, typename TAction, typename TCost>
+double SolveAll(const std::vector<std::unique_ptr<Problem<TState, TAction, TCost>>>&
+                    problems,
+                uint64_t* out_total_depth) {
+    using Comparator = CompareByAStar<TState, TAction, TCost>;
+
+    *out_total_depth = 0;
+    Clock::time_point start = Clock::now();
+    for (const auto& problem : problems) {
+        auto solution = search_algorithm::BestFirstSearch<TState, TAction,
+                                                          TCost, Comparator>(
+            *problem);
+        if (solution) *out_total_depth += solution->GetDepth();
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+template <std::size_t N>
+void RunBenchmark(int num_instances, int walk_length) {
+    using Fixed = sliding_tile::FixedSlidingTileProblem<N>;
+    using sliding_tile::Action;
+    using sliding_tile::CostType;
+
+    std::vector<sliding_tile::State> instances =
+        MakeInstances(N, num_instances, walk_length, 42);
+
+    std::vector<std::unique_ptr<
+        Problem<sliding_tile::State, Action, CostType>>>
+        runtime_problems;
+    std::vector<std::unique_ptr<Problem<typename Fixed::StateType, Action,
+                                        CostType>>>
+        fixed_problems;
+    for (const auto& state : instances) {
+        runtime_problems.push_back(
+            std::make_unique<sliding_tile::SlidingTileProblem>(state, N));
+        fixed_problems.push_back(std::make_unique<Fixed>(state));
+    }
+
+    uint64_t runtime_depth = 0, fixed_depth = 0;
+    double runtime_ms = SolveAll(runtime_problems, &runtime_depth);
+    double fixed_ms = SolveAll(fixed_problems, &fixed_depth);
+
+    std::cout << N << "x" << N << "  instances " << std::setw(3)
+              << num_instances << "  walk " << std::setw(3) << walk_length
+              << "  runtime " << std::setw(10) << std::fixed
+              << std::setprecision(2) << runtime_ms << " ms"
+              << "  fixed " << std::setw(10) << fixed_ms << " ms"
+              << "  speedup " << std::setw(6) << runtime_ms / fixed_ms << "x";
+    if (runtime_depth != fixed_depth)
+        std::cout << "  MISMATCH (" << runtime_depth << " vs " << fixed_depth
+                  << ")";
+    std::cout << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    std::cout << "A* with Manhattan distance, runtime vs compile-time "
+                 "dimension"
+              << std::endl;
+
+    RunBenchmark<3>(50, 60);
+    RunBenchmark<4>(20, 40);
+    RunBenchmark<5>(10, 30);
+
+    return 0;
+}
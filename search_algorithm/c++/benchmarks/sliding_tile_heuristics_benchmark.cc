@@ -0,0 +1,129 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/sliding_tile_problem.h"
+
+// Compares the sliding tile heuristics by cost per evaluation and by A*
+// expansions and time on the same instances, per board size
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using sliding_tile::HeuristicType;
+using sliding_tile::SlidingTileProblem;
+using sliding_tile::State;
+
+// Counts expansions: Node::Expand asks for the actions once per node
+class CountingProblem : public SlidingTileProblem {
+   public:
+    CountingProblem(const State& state, uint64_t dimension,
+                    HeuristicType heuristics)
+        : SlidingTileProblem(state, dimension, heuristics) {}
+
+    std::vector<sliding_tile::Action> GetActions(
+        const State& state) const override {
+        ++expansions_;
+        return SlidingTileProblem::GetActions(state);
+    }
+
+    uint64_t GetExpansions() const { return expansions_; }
+
+   private:
+    mutable uint64_t expansions_ = 0;
+};
+
+// Scrambles the goal with a random walk so every instance is solvable
+std::vector<State> MakeInstances(uint64_t dimension, int num_instances,
+                                 int walk_length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    SlidingTileProblem problem(
+        State(dimension, std::vector<uint64_t>(dimension, 0)), dimension);
+
+    std::vector<State> instances;
+    for (int i = 0; i < num_instances; ++i) {
+        State state = problem.GetGoalState();
+        for (int step = 0; step < walk_length; ++step) {
+            std::vector<sliding_tile::Action> actions =
+                problem.GetActions(state);
+            state = *problem.GetResult(state, actions[rng() % actions.size()]);
+        }
+        instances.push_back(state);
+    }
+    return instances;
+}
+
+void RunBenchmark(uint64_t dimension, int num_instances, int walk_length) {
+    using Comparator = CompareByAStar<State, sliding_tile::Action,
+                                      sliding_tile::CostType>;
+
+    std::vector<State> instances =
+        MakeInstances(dimension, num_instances, walk_length, 1234);
+
+    const std::vector<std::pair<std::string, HeuristicType>> heuristics = {
+        {"manhattan", HeuristicType::kManhattan},
+        {"linear conflict", HeuristicType::kLinearConflict},
+        {"walking distance", HeuristicType::kWalkingDistance},
+        {"max(LC, WD)",
+         HeuristicType::kLinearConflict | HeuristicType::kWalkingDistance},
+    };
+
+    std::cout << dimension << "x" << dimension << ", " << num_instances
+              << " instances, random walk of " << walk_length << std::endl;
+
+    for (const auto& [name, type] : heuristics) {
+        // Cost per evaluation
+        SlidingTileProblem evaluator(instances[0], dimension, type);
+        volatile int sink = 0;
+        const int repetitions = 20000;
+        Clock::time_point start = Clock::now();
+        for (int rep = 0; rep < repetitions; ++rep)
+            for (const State& state : instances)
+                sink = sink + evaluator.Heuristic(state);
+        double eval_ns =
+            std::chrono::duration<double, std::nano>(Clock::now() - start)
+                .count() /
+            (static_cast<double>(repetitions) * instances.size());
+
+        // A* expansions and time
+        uint64_t expansions = 0, total_depth = 0, total_h0 = 0;
+        start = Clock::now();
+        for (const State& state : instances) {
+            CountingProblem problem(state, dimension, type);
+            total_h0 += problem.Heuristic(state);
+            auto solution = search_algorithm::BestFirstSearch<
+                State, sliding_tile::Action, sliding_tile::CostType,
+                Comparator>(problem);
+            if (solution) total_depth += solution->GetDepth();
+            expansions += problem.GetExpansions();
+        }
+        double search_ms =
+            std::chrono::duration<double, std::milli>(Clock::now() - start)
+                .count();
+
+        std::cout << "  " << std::left << std::setw(18) << name << std::right
+                  << "  eval " << std::fixed << std::setprecision(1)
+                  << std::setw(7) << eval_ns << " ns"
+                  << "  avg h0 " << std::setw(5)
+                  << static_cast<double>(total_h0) / instances.size()
+                  << "  avg depth " << std::setw(5)
+                  << static_cast<double>(total_depth) / instances.size()
+                  << "  expansions " << std::setw(9) << expansions
+                  << "  A* " << std::setw(9) << std::setprecision(2)
+                  << search_ms << " ms" << std::endl;
+    }
+}
+
+}  // namespace
+
+int main() {
+    RunBenchmark(3, 20, 200);
+    RunBenchmark(4, 10, 60);
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/problems/fixed_sliding_tile_problem.h"
+#include "data_structure/problems/sliding_tile_problem.h"
+
+// Compares A* calling the problem through the Problem vtable against the
+// statically dispatched path (StaticProblem) on the same instances
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kRounds = 3;
+
+// A* through a Problem reference: every problem call is virtual
+template <typename State, typename Action, typename Cost, typename TProblem>
+uint64_t SolveVirtual(const TProblem& problem) {
+    const Problem<State, Action, Cost>& base = problem;
+    auto solution = search_algorithm::BestFirstSearch<
+        State, Action, Cost, CompareByAStar<State, Action, Cost>>(base);
+    return solution ? solution->GetDepth() : 0;
+}
+
+// A* on the concrete type: problem calls are bound at compile time
+template <typename State, typename Action, typename Cost, typename TProblem>
+uint64_t SolveStatic(const TProblem& problem) {
+    auto solution = search_algorithm::BestFirstSearch<
+        State, Action, Cost, CompareByAStar<State, Action, Cost, TProblem>>(
+        problem);
+    return solution ? solution->GetDepth() : 0;
+}
+
+template <typename Solve, typename TProblem>
+double TimeAll(Solve solve, const std::vector<TProblem>& problems,
+               uint64_t* out_total_depth) {
+    *out_total_depth = 0;
+    Clock::time_point start = Clock::now();
+    for (const TProblem& problem : problems)
+        *out_total_depth += solve(problem);
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+// Alternates the two paths and keeps the fastest round of each
+template <typename State, typename Action, typename Cost, typename TProblem>
+void Compare(const std::string& name, const std::vector<TProblem>& problems) {
+    double virtual_ms = 1e300, static_ms = 1e300;
+    uint64_t virtual_depth = 0, static_depth = 0;
+    for (int round = 0; round < kRounds; ++round) {
+        virtual_ms = std::min(
+            virtual_ms,
+            TimeAll(SolveVirtual<State, Action, Cost, TProblem>, problems,
+                    &virtual_depth));
+        static_ms = std::min(
+            static_ms, TimeAll(SolveStatic<State, Action, Cost, TProblem>,
+                               problems, &static_depth));
+    }
+
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::fixed << std::setprecision(2) << "  virtual "
+              << std::setw(9) << virtual_ms << " ms  static " << std::setw(9)
+              << static_ms << " ms  speedup " << virtual_ms / static_ms
+              << "x  (depth " << virtual_depth << " / " << static_depth << ")"
+              << std::endl;
+}
+
+// Scrambles the goal with a random walk so every instance is solvable
+template <typename TProblem>
+std::vector<typename TProblem::StateType> MakeFixedInstances(
+    int num_instances, int walk_length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    TProblem problem(TProblem::GetGoalState());
+
+    std::vector<typename TProblem::StateType> instances;
+    for (int i = 0; i < num_instances; ++i) {
+        typename TProblem::StateType state = TProblem::GetGoalState();
+        for (int step = 0; step < walk_length; ++step) {
+            auto actions = problem.GetActions(state);
+            state = *problem.GetResult(state, actions[rng() % actions.size()]);
+        }
+        instances.push_back(state);
+    }
+    return instances;
+}
+
+}  // namespace
+
+int main() {
+    using Fixed3 = sliding_tile::FixedSlidingTileProblem<3>;
+    using Fixed4 = sliding_tile::FixedSlidingTileProblem<4>;
+    using sliding_tile::Action;
+    using sliding_tile::CostType;
+
+    std::vector<Fixed3> fixed3;
+    std::vector<sliding_tile::SlidingTileProblem> runtime3;
+    for (const auto& state : MakeFixedInstances<Fixed3>(20, 200, 42)) {
+        fixed3.emplace_back(state);
+        runtime3.emplace_back(Fixed3::ToState(state), 3);
+    }
+    Compare<sliding_tile::State, Action, CostType>("SlidingTileProblem 3x3",
+                                                   runtime3);
+    Compare<Fixed3::StateType, Action, CostType>("FixedSlidingTile<3>",
+                                                 fixed3);
+
+    std::vector<Fixed4> fixed4;
+    for (const auto& state : MakeFixedInstances<Fixed4>(10, 60, 7))
+        fixed4.emplace_back(state);
+    Compare<Fixed4::StateType, Action, CostType>("FixedSlidingTile<4>",
+                                                 fixed4);
+
+    std::vector<chess_board::ChessBoardProblem> chess;
+    chess.emplace_back(1);
+    chess.emplace_back(2);
+    Compare<chess_board::State, chess_board::Action,
+            chess_board::ChessCostType>("ChessBoardProblem 1, 2", chess);
+
+    return 0;
+}
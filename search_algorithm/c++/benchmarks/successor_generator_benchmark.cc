@@ -0,0 +1,125 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/state_hash.h"
+
+// Compares breadth-first search building every child with Node::Expand
+// against the lazy SuccessorGenerator the library now uses, by states built
+// and time, on the chess presets
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using chess_board::Action;
+using chess_board::ChessCostType;
+using chess_board::State;
+using NodeType = Node<State, Action, ChessCostType>;
+
+constexpr int kRounds = 3;
+
+// Count built states: every child costs one GetResult call
+class CountingChessProblem : public chess_board::ChessBoardProblem {
+   public:
+    using ChessBoardProblem::ChessBoardProblem;
+
+    std::unique_ptr<State> GetResult(const State& state,
+                                     const Action& action) const override {
+        ++states_built_;
+        return ChessBoardProblem::GetResult(state, action);
+    }
+
+    uint64_t GetStatesBuilt() const { return states_built_; }
+    void Reset() { states_built_ = 0; }
+
+   private:
+    mutable uint64_t states_built_ = 0;
+};
+
+// The breadth-first search as it was before the generator
+std::shared_ptr<NodeType> EagerBreadthFirstSearch(
+    CountingChessProblem& problem) {
+    auto root = std::make_shared<NodeType>(problem.GetInitialState());
+    if (problem.IsGoal(root->GetState())) return root;
+
+    std::queue<std::shared_ptr<NodeType>> fifo_queue;
+    fifo_queue.push(root);
+    std::unordered_set<State, StateHash<State>> reached;
+    reached.insert(root->GetState());
+
+    while (!fifo_queue.empty()) {
+        std::shared_ptr<NodeType> node = fifo_queue.front();
+        fifo_queue.pop();
+
+        for (const auto& child : node->Expand(problem)) {
+            if (problem.IsGoal(child->GetState())) return child;
+            if (reached.insert(child->GetState()).second)
+                fifo_queue.push(child);
+        }
+    }
+    return nullptr;
+}
+
+struct Result {
+    uint64_t states_built = 0;
+    uint64_t depth = 0;
+    double ms = 0;
+};
+
+template <typename Search>
+Result Run(CountingChessProblem& problem, Search search) {
+    problem.Reset();
+    Clock::time_point start = Clock::now();
+    std::shared_ptr<NodeType> solution = search();
+
+    Result result;
+    result.ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    result.states_built = problem.GetStatesBuilt();
+    if (solution) result.depth = solution->GetDepth();
+    return result;
+}
+
+void Print(const std::string& name, const Result& result) {
+    std::cout << "  " << std::left << std::setw(8) << name << std::right
+              << "  depth " << std::setw(3) << result.depth
+              << "  states built " << std::setw(10) << result.states_built
+              << "  time " << std::fixed << std::setprecision(2)
+              << std::setw(9) << result.ms << " ms" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    for (int preset : {1, 2}) {
+        CountingChessProblem problem(preset);
+        std::cout << "Chess preset " << preset << std::endl;
+
+        // Alternate the runs and keep the fastest of each, the first run
+        // of a process pays for growing the heap
+        Result eager, lazy;
+        for (int round = 0; round < kRounds; ++round) {
+            Result result =
+                Run(problem, [&] { return EagerBreadthFirstSearch(problem); });
+            if (round == 0 || result.ms < eager.ms) eager = result;
+
+            result = Run(problem, [&] {
+                return search_algorithm::BreadthFirstSearch(problem);
+            });
+            if (round == 0 || result.ms < lazy.ms) lazy = result;
+        }
+        Print("eager", eager);
+        Print("lazy", lazy);
+    }
+
+    return 0;
+}
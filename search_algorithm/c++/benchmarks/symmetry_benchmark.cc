@@ -0,0 +1,107 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/sliding_tile_problem.h"
+
+// Compares breadth-first search and A* with and without symmetry reduction
+// of the reached set (SearchOptions::reduce_symmetry), by reached states,
+// expansions and time, on scrambled 3x3 sliding tile instances
+//
+// The chess presets are left out: neither board nor goal is symmetric, and
+// interchangeable pieces already share one board representation.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using sliding_tile::Action;
+using sliding_tile::CostType;
+using sliding_tile::State;
+using Comparator = CompareByAStar<State, Action, CostType>;
+
+struct Result {
+    search_algorithm::SearchStatistics statistics;
+    uint64_t depth = 0;
+    double ms = 0;
+};
+
+template <typename Search>
+Result Run(Search search) {
+    Result result;
+    search_algorithm::SearchOptions options;
+    options.statistics = &result.statistics;
+
+    Clock::time_point start = Clock::now();
+    auto solution = search(options);
+    result.ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (solution) result.depth = solution->GetDepth();
+    return result;
+}
+
+template <typename Search>
+void Compare(const std::string& name, Search search) {
+    Result plain = Run([&](search_algorithm::SearchOptions options) {
+        return search(options);
+    });
+    Result reduced = Run([&](search_algorithm::SearchOptions options) {
+        options.reduce_symmetry = true;
+        return search(options);
+    });
+
+    for (const auto& [label, result] :
+         {std::make_pair("plain", plain), std::make_pair("symmetry", reduced)})
+        std::cout << "  " << std::left << std::setw(4) << name << " "
+                  << std::setw(8) << label << std::right << "  depth "
+                  << std::setw(3) << result.depth << "  reached "
+                  << std::setw(7) << result.statistics.reached
+                  << "  expanded " << std::setw(7)
+                  << result.statistics.expanded << "  time " << std::fixed
+                  << std::setprecision(2) << std::setw(8) << result.ms
+                  << " ms" << std::endl;
+
+    std::cout << "  " << std::left << std::setw(4) << name << std::right
+              << " reached states -"
+              << std::setprecision(1)
+              << 100.0 * (1.0 - static_cast<double>(
+                                    reduced.statistics.reached) /
+                                    plain.statistics.reached)
+              << "%" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    // Scramble the goal with random walks
+    std::mt19937 rng(7);
+    const uint64_t dimension = 3;
+    sliding_tile::SlidingTileProblem scrambler(
+        State(dimension, std::vector<uint64_t>(dimension, 0)), dimension);
+
+    for (int instance = 0; instance < 3; ++instance) {
+        State state = scrambler.GetGoalState();
+        for (int step = 0; step < 200; ++step) {
+            auto actions = scrambler.GetActions(state);
+            state = *scrambler.GetResult(state, actions[rng() % actions.size()]);
+        }
+
+        std::cout << "3x3 instance " << instance << std::endl;
+        sliding_tile::SlidingTileProblem problem(state, dimension);
+        Compare("BFS", [&](const search_algorithm::SearchOptions& options) {
+            return search_algorithm::BreadthFirstSearch(problem, options);
+        });
+        Compare("A*", [&](const search_algorithm::SearchOptions& options) {
+            return search_algorithm::BestFirstSearch<State, Action, CostType,
+                                                     Comparator>(problem,
+                                                                 options);
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/search_trace.h"
+
+// Measures the overhead of tracing A* on chess preset 2 and leaves the trace
+// behind for bin/trace_report
+//
+// Usage: trace_benchmark [trace file]
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using chess_board::Action;
+using chess_board::ChessCostType;
+using chess_board::State;
+using Comparator = CompareByAStar<State, Action, ChessCostType>;
+
+double RunAStar(const chess_board::ChessBoardProblem& problem,
+                const search_algorithm::SearchOptions& options) {
+    Clock::time_point start = Clock::now();
+    search_algorithm::BestFirstSearch<State, Action, ChessCostType, Comparator>(
+        problem, options);
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : "/tmp/chess_a_star.trace";
+    chess_board::ChessBoardProblem problem(2);
+
+    double plain_ms = RunAStar(problem, search_algorithm::SearchOptions());
+
+    uint64_t records = 0;
+    double traced_ms = 0;
+    {
+        TraceWriter trace(path);
+        search_algorithm::SearchOptions options;
+        options.trace = &trace;
+        traced_ms = RunAStar(problem, options);
+        records = trace.GetNumRecords();
+    }
+
+    std::cout << std::fixed << std::setprecision(1) << "A* without trace "
+              << plain_ms << " ms, with trace " << traced_ms << " ms ("
+              << records << " records of " << sizeof(TraceRecord)
+              << " bytes to " << path << ")" << std::endl;
+
+    return 0;
+}
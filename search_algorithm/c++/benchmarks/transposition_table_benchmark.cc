@@ -0,0 +1,125 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/problems/sliding_tile_problem.h"
+#include "data_structure/transposition_table.h"
+
+// Compares iterative deepening with and without a transposition table, by
+// expansions and time, on sliding tile instances and the chess presets
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Count expansions: Node::Expand asks for the actions once per node
+class CountingTileProblem : public sliding_tile::SlidingTileProblem {
+   public:
+    using SlidingTileProblem::SlidingTileProblem;
+
+    std::vector<sliding_tile::Action> GetActions(
+        const sliding_tile::State& state) const override {
+        ++expansions_;
+        return SlidingTileProblem::GetActions(state);
+    }
+
+    uint64_t GetExpansions() const { return expansions_; }
+
+   private:
+    mutable uint64_t expansions_ = 0;
+};
+
+class CountingChessProblem : public chess_board::ChessBoardProblem {
+   public:
+    using ChessBoardProblem::ChessBoardProblem;
+
+    std::vector<chess_board::Action> GetActions(
+        const chess_board::State& state) const override {
+        ++expansions_;
+        return ChessBoardProblem::GetActions(state);
+    }
+
+    uint64_t GetExpansions() const { return expansions_; }
+
+   private:
+    mutable uint64_t expansions_ = 0;
+};
+
+struct Result {
+    uint64_t expansions = 0;
+    uint64_t depth = 0;
+    double ms = 0;
+};
+
+template <typename Problem>
+Result RunIds(const Problem& problem, TranspositionTable* table) {
+    search_algorithm::SearchOptions options;
+    options.transposition_table = table;
+
+    Clock::time_point start = Clock::now();
+    auto solution = search_algorithm::IterativeDeepeningSearch(problem, options);
+
+    Result result;
+    result.ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    result.expansions = problem.GetExpansions();
+    if (solution) result.depth = solution->GetDepth();
+    return result;
+}
+
+void Print(const std::string& name, const Result& result) {
+    std::cout << "  " << std::left << std::setw(16) << name << std::right
+              << "  depth " << std::setw(3) << result.depth << "  expansions "
+              << std::setw(10) << result.expansions << "  time " << std::fixed
+              << std::setprecision(2) << std::setw(9) << result.ms << " ms"
+              << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    TranspositionTable table(1 << 20);
+
+    // Sliding tile: scramble the goal with random walks
+    std::mt19937 rng(42);
+    const uint64_t dimension = 3;
+    sliding_tile::SlidingTileProblem scrambler(
+        sliding_tile::State(dimension, std::vector<uint64_t>(dimension, 0)),
+        dimension);
+
+    for (int instance = 0; instance < 3; ++instance) {
+        sliding_tile::State state = scrambler.GetGoalState();
+        for (int step = 0; step < 60; ++step) {
+            auto actions = scrambler.GetActions(state);
+            state = *scrambler.GetResult(state, actions[rng() % actions.size()]);
+        }
+
+        std::cout << "3x3 instance " << instance << std::endl;
+        CountingTileProblem plain_problem(state, dimension);
+        Print("without table", RunIds(plain_problem, nullptr));
+        CountingTileProblem table_problem(state, dimension);
+        Print("with table", RunIds(table_problem, &table));
+    }
+
+    std::cout << "chess preset 1" << std::endl;
+    CountingChessProblem plain_chess(1);
+    Print("without table", RunIds(plain_chess, nullptr));
+    CountingChessProblem table_chess(1);
+    Print("with table", RunIds(table_chess, &table));
+
+    // Without the table this preset takes minutes
+    std::cout << "chess preset 2" << std::endl;
+    CountingChessProblem table_chess_2(2);
+    Print("with table", RunIds(table_chess_2, &table));
+
+    std::cout << "table holds " << table.CountEntries() << " of "
+              << table.GetCapacity() << " entries" << std::endl;
+
+    return 0;
+}
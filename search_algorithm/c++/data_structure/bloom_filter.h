@@ -0,0 +1,102 @@
+/**
+ * @file bloom_filter.h
+ * @brief Bloom filter over 64-bit keys
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_BLOOM_FILTER_H_
+#define SEARCH_ALG_DATA_STRUCTURE_BLOOM_FILTER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Set membership with false positives and no false negatives
+ *
+ * Keys are well mixed 64-bit values (e.g. state fingerprints), so no
+ * further hashing is done. The filter is blocked: the high bits of the key
+ * pick one 64-byte block (a cache line) and the k bits of the key all lie in
+ * it, derived from the low half of the key by double hashing. A query costs
+ * one cache miss instead of k, for a slightly higher false positive rate.
+ */
+class BloomFilter {
+   public:
+    /**
+     * @param num_bits Size of the filter, rounded up to a power of two of
+     * at least one block
+     * @param num_hashes Bits set per key
+     */
+    BloomFilter(std::size_t num_bits, unsigned num_hashes)
+        : num_hashes_(std::max(1u, num_hashes)) {
+        std::size_t bits = kBlockBits;
+        while (bits < num_bits) bits *= 2;
+        words_.assign(bits / 64, 0);
+        block_shift_ = 64;
+        for (std::size_t blocks = bits / kBlockBits; blocks > 1; blocks /= 2)
+            --block_shift_;
+    }
+
+    /**
+     * @brief Gets the number of hashes minimizing false positives
+     * @param bits_per_key Filter bits per key it will hold
+     * @return round(bits_per_key * ln 2), between 1 and 16
+     */
+    static unsigned OptimalHashes(double bits_per_key) {
+        long hashes = std::lround(bits_per_key * 0.6931471805599453);
+        return static_cast<unsigned>(std::clamp(hashes, 1L, 16L));
+    }
+
+    /**
+     * @brief Adds a key
+     * @param key The key
+     */
+    void Insert(uint64_t key) {
+        uint64_t* block = &words_[BlockStart(key)];
+        uint32_t h1 = static_cast<uint32_t>(key), h2 = (h1 >> 16) | 1;
+        for (unsigned i = 0; i < num_hashes_; ++i, h1 += h2)
+            block[(h1 % kBlockBits) / 64] |= uint64_t{1} << (h1 % 64);
+    }
+
+    /**
+     * @brief Tests a key
+     * @param key The key
+     * @return false if the key was never inserted; true if it may have been
+     */
+    bool MayContain(uint64_t key) const {
+        const uint64_t* block = &words_[BlockStart(key)];
+        uint32_t h1 = static_cast<uint32_t>(key), h2 = (h1 >> 16) | 1;
+        for (unsigned i = 0; i < num_hashes_; ++i, h1 += h2) {
+            if (!(block[(h1 % kBlockBits) / 64] & (uint64_t{1} << (h1 % 64))))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Gets the size of the filter
+     * @return Bytes of bit array
+     */
+    std::size_t GetMemoryBytes() const {
+        return words_.size() * sizeof(uint64_t);
+    }
+
+   private:
+    static constexpr unsigned kBlockBits = 512;  ///< One 64-byte cache line
+
+    std::vector<uint64_t> words_;
+    unsigned block_shift_;  ///< 64 - log2(number of blocks)
+    unsigned num_hashes_;
+
+    /// Index of the first word of the key's block
+    std::size_t BlockStart(uint64_t key) const {
+        // A shift by 64 is undefined, so a single block is special-cased
+        std::size_t block = block_shift_ < 64 ? key >> block_shift_ : 0;
+        return block * (kBlockBits / 64);
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_BLOOM_FILTER_H_
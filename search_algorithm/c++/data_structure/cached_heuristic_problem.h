@@ -0,0 +1,217 @@
+/**
+ * @file cached_heuristic_problem.h
+ * @brief Problem wrapper that memoizes heuristic values
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_CACHED_HEURISTIC_PROBLEM_H_
+#define SEARCH_ALG_DATA_STRUCTURE_CACHED_HEURISTIC_PROBLEM_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "fingerprint_set.h"
+#include "problem.h"
+
+/**
+ * @brief Forwards to another problem, caching its Heuristic values
+ *
+ * Every call but Heuristic goes straight to the wrapped problem. Heuristic
+ * values are kept in a fixed-size set-associative table keyed by the state's
+ * 64-bit fingerprint: a key picks a bucket of kBucketSize entries sharing a
+ * cache line, a miss computes the value and stores it over a free or an
+ * arbitrary entry of the bucket. The table never grows.
+ *
+ * As in TranspositionTable, each entry is a value word and the key XOR the
+ * value word in two atomics, so threads can share the wrapper without locks:
+ * a lookup racing with a store sees a key mismatch and computes the value.
+ * Hit and miss counters are relaxed atomics.
+ *
+ * Worth it when Heuristic costs more than hashing the state and the same
+ * states are evaluated repeatedly, e.g. by A* comparisons or across the
+ * iterations of IDA*.
+ *
+ * @note Two states with the same 64-bit fingerprint share a value.
+ *
+ * @tparam TState Type representing a state in the problem space
+ * @tparam TAction Type representing actions that can be applied to states
+ * @tparam CostType Type representing the cost of actions, at most 8 bytes
+ */
+template <typename TState, typename TAction, typename CostType>
+class CachedHeuristicProblem : public Problem<TState, TAction, CostType> {
+    static_assert(std::is_trivially_copyable<CostType>::value &&
+                      sizeof(CostType) <= sizeof(uint64_t),
+                  "Cached heuristic values must fit in a 64-bit word");
+
+   public:
+    static constexpr std::size_t kBucketSize = 4;  ///< Entries per bucket
+
+    /**
+     * @param problem Problem to forward to, must outlive the wrapper
+     * @param num_entries Cache capacity, rounded up to a power of two
+     * buckets
+     */
+    CachedHeuristicProblem(const Problem<TState, TAction, CostType>& problem,
+                           std::size_t num_entries)
+        : Problem<TState, TAction, CostType>(problem.GetInitialState()),
+          problem_(problem),
+          num_buckets_(RoundUpBuckets(num_entries)),
+          buckets_(std::make_unique<Bucket[]>(num_buckets_)) {}
+
+    CachedHeuristicProblem(const CachedHeuristicProblem&) = delete;
+    CachedHeuristicProblem& operator=(const CachedHeuristicProblem&) = delete;
+
+    virtual ~CachedHeuristicProblem() = default;
+
+    virtual bool IsGoal(const TState& state) const override {
+        return problem_.IsGoal(state);
+    }
+
+    virtual std::vector<TAction> GetActions(
+        const TState& state) const override {
+        return problem_.GetActions(state);
+    }
+
+    virtual std::unique_ptr<TState> GetResult(
+        const TState& state, const TAction& action) const override {
+        return problem_.GetResult(state, action);
+    }
+
+    virtual CostType GetActionCost(const TState& state, const TAction& action,
+                                   const TState& new_state) const override {
+        return problem_.GetActionCost(state, action, new_state);
+    }
+
+    virtual std::string GetStateString(const TState& state) const override {
+        return problem_.GetStateString(state);
+    }
+
+    virtual TState Canonicalize(const TState& state) const override {
+        return problem_.Canonicalize(state);
+    }
+
+    /**
+     * @brief Gets the wrapped problem's heuristic, from the cache if stored
+     * @param state The state to evaluate
+     * @return Heuristic estimate of cost to goal
+     */
+    virtual CostType Heuristic(const TState& state) const override {
+        uint64_t key = FingerprintSet::Fingerprint(state);
+        if (key == 0) key = 1;  // Free entries read as key 0
+        Bucket& bucket = buckets_[key & (num_buckets_ - 1)];
+
+        for (Slot& slot : bucket.slots) {
+            uint64_t data = slot.data.load(std::memory_order_relaxed);
+            uint64_t check = slot.check.load(std::memory_order_relaxed);
+            if ((check ^ data) == key) {
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return Unpack(data);
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+
+        CostType value = problem_.Heuristic(state);
+        uint64_t data = Pack(value);
+
+        // A free entry if there is one, otherwise one picked by the key's
+        // high bits, which the bucket index does not use
+        Slot* victim = &bucket.slots[(key >> 60) % kBucketSize];
+        for (Slot& slot : bucket.slots) {
+            if (slot.check.load(std::memory_order_relaxed) == 0 &&
+                slot.data.load(std::memory_order_relaxed) == 0) {
+                victim = &slot;
+                break;
+            }
+        }
+        victim->data.store(data, std::memory_order_relaxed);
+        victim->check.store(key ^ data, std::memory_order_relaxed);
+        return value;
+    }
+
+    /**
+     * @brief Gets the number of heuristic values served from the cache
+     * @return Hits since construction or the last Clear
+     */
+    uint64_t GetHits() const { return hits_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Gets the number of heuristic values computed
+     * @return Misses since construction or the last Clear
+     */
+    uint64_t GetMisses() const {
+        return misses_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the fraction of Heuristic calls served from the cache
+     * @return Hits over calls, 0 before the first call
+     */
+    double GetHitRate() const {
+        uint64_t hits = GetHits(), calls = hits + GetMisses();
+        return calls ? static_cast<double>(hits) / calls : 0.0;
+    }
+
+    /**
+     * @brief Gets the number of entries the cache holds
+     * @return Capacity in entries
+     */
+    std::size_t GetCapacity() const { return num_buckets_ * kBucketSize; }
+
+    /**
+     * @brief Removes every entry and resets the counters
+     * @warning Not safe to call while other threads use the wrapper
+     */
+    void Clear() {
+        for (std::size_t b = 0; b < num_buckets_; ++b) {
+            for (Slot& slot : buckets_[b].slots) {
+                slot.data.store(0, std::memory_order_relaxed);
+                slot.check.store(0, std::memory_order_relaxed);
+            }
+        }
+        hits_.store(0, std::memory_order_relaxed);
+        misses_.store(0, std::memory_order_relaxed);
+    }
+
+   private:
+    struct Slot {
+        std::atomic<uint64_t> check{0};  ///< Key XOR data
+        std::atomic<uint64_t> data{0};   ///< Bits of the value
+    };
+
+    struct alignas(64) Bucket {
+        Slot slots[kBucketSize];
+    };
+
+    const Problem<TState, TAction, CostType>& problem_;
+    std::size_t num_buckets_;
+    std::unique_ptr<Bucket[]> buckets_;
+    mutable std::atomic<uint64_t> hits_{0};
+    mutable std::atomic<uint64_t> misses_{0};
+
+    static std::size_t RoundUpBuckets(std::size_t num_entries) {
+        std::size_t buckets = 1;
+        while (buckets * kBucketSize < num_entries) buckets <<= 1;
+        return buckets;
+    }
+
+    static uint64_t Pack(CostType value) {
+        uint64_t data = 0;
+        std::memcpy(&data, &value, sizeof(CostType));
+        return data;
+    }
+
+    static CostType Unpack(uint64_t data) {
+        CostType value;
+        std::memcpy(&value, &data, sizeof(CostType));
+        return value;
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_CACHED_HEURISTIC_PROBLEM_H_
@@ -0,0 +1,171 @@
+/**
+ * @file fingerprint_set.h
+ * @brief Compact set of 64-bit state fingerprints
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_FINGERPRINT_SET_H_
+#define SEARCH_ALG_DATA_STRUCTURE_FINGERPRINT_SET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "bloom_filter.h"
+#include "state_hash.h"
+
+/**
+ * @brief Set of states represented by 64-bit fingerprints only
+ *
+ * Stores no states: each state is reduced to a 64-bit fingerprint (its
+ * StateHash, put through a 64-bit finalizer) kept in an open-addressing
+ * table of at most 75% load, i.e. 10.7 to 21.3 bytes per state. Two distinct
+ * states with the same fingerprint are taken for one; among n states this
+ * happens about n^2 / 2^65 times (0.03 expected collisions for 10^9
+ * states) if StateHash itself does not collide, so a StateHash that
+ * loses information (e.g. one built from weak combining of small integers)
+ * costs states here, not just time.
+ *
+ * An optional Bloom filter in front answers most queries for never-seen
+ * states without touching the table. It is rebuilt from the table whenever
+ * the table grows, so it keeps its bits per state.
+ */
+class FingerprintSet {
+   public:
+    /**
+     * @param bloom_bits_per_state Bloom filter bits per stored state, 0 for
+     * no filter
+     */
+    explicit FingerprintSet(std::size_t bloom_bits_per_state = 0)
+        : bloom_bits_per_state_(bloom_bits_per_state), slots_(16, kEmpty) {
+        RebuildBloomFilter();
+    }
+
+    /**
+     * @brief Computes the fingerprint of a state
+     * @param state The state
+     * @return Well mixed 64-bit fingerprint
+     */
+    template <typename TState>
+    static uint64_t Fingerprint(const TState& state) {
+        uint64_t x = static_cast<uint64_t>(StateHash<TState>{}(state));
+        // splitmix64 finalizer: every input bit affects every output bit
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    /**
+     * @brief Adds a fingerprint
+     * @param fingerprint The fingerprint
+     * @return false if it was already in the set
+     */
+    bool Insert(uint64_t fingerprint) {
+        if (fingerprint == kEmpty) fingerprint = 1;
+        bool known = MayContain(fingerprint);
+
+        std::size_t mask = slots_.size() - 1;
+        std::size_t i = fingerprint & mask;
+        for (; slots_[i] != kEmpty; i = (i + 1) & mask)
+            if (known && slots_[i] == fingerprint) return false;
+
+        slots_[i] = fingerprint;
+        ++size_;
+        if (bloom_filter_) bloom_filter_->Insert(fingerprint);
+        if (4 * size_ > 3 * slots_.size()) Grow();
+        return true;
+    }
+
+    /**
+     * @brief Tests a fingerprint
+     * @param fingerprint The fingerprint
+     * @return true if it is in the set
+     */
+    bool Contains(uint64_t fingerprint) const {
+        if (fingerprint == kEmpty) fingerprint = 1;
+        if (!MayContain(fingerprint)) return false;
+
+        std::size_t mask = slots_.size() - 1;
+        for (std::size_t i = fingerprint & mask; slots_[i] != kEmpty;
+             i = (i + 1) & mask)
+            if (slots_[i] == fingerprint) return true;
+        return false;
+    }
+
+    /**
+     * @brief Gets the number of fingerprints
+     * @return Stored fingerprints
+     */
+    std::size_t GetSize() const { return size_; }
+
+    /**
+     * @brief Gets the memory held by the table and the filter
+     * @return Bytes
+     */
+    std::size_t GetMemoryBytes() const {
+        return slots_.size() * sizeof(uint64_t) +
+               (bloom_filter_ ? bloom_filter_->GetMemoryBytes() : 0);
+    }
+
+    /**
+     * @brief Gets the number of queries the Bloom filter answered alone
+     * @return Inserts and lookups of fingerprints the filter ruled out
+     */
+    uint64_t GetBloomRejections() const { return bloom_rejections_; }
+
+   private:
+    static constexpr uint64_t kEmpty = 0;  ///< Fingerprint 0 is stored as 1
+
+    std::size_t bloom_bits_per_state_;
+    std::vector<uint64_t> slots_;  ///< Size is a power of two
+    std::size_t size_ = 0;
+    std::unique_ptr<BloomFilter> bloom_filter_;
+    mutable uint64_t bloom_rejections_ = 0;
+
+    /**
+     * @brief Asks the Bloom filter, if any
+     * @param fingerprint The fingerprint
+     * @return false if the fingerprint is certainly not in the set
+     */
+    bool MayContain(uint64_t fingerprint) const {
+        if (!bloom_filter_ || bloom_filter_->MayContain(fingerprint))
+            return true;
+        ++bloom_rejections_;
+        return false;
+    }
+
+    void Grow() {
+        std::vector<uint64_t> old_slots(2 * slots_.size(), kEmpty);
+        old_slots.swap(slots_);
+        std::size_t mask = slots_.size() - 1;
+        for (uint64_t fingerprint : old_slots) {
+            if (fingerprint == kEmpty) continue;
+            std::size_t i = fingerprint & mask;
+            while (slots_[i] != kEmpty) i = (i + 1) & mask;
+            slots_[i] = fingerprint;
+        }
+        RebuildBloomFilter();
+    }
+
+    /**
+     * @brief Sizes the filter for the table's capacity and refills it
+     */
+    void RebuildBloomFilter() {
+        if (bloom_bits_per_state_ == 0) return;
+        // Sized for the most states the table holds before it grows again
+        std::size_t capacity = 3 * slots_.size() / 4;
+        bloom_filter_ = std::make_unique<BloomFilter>(
+            capacity * bloom_bits_per_state_,
+            BloomFilter::OptimalHashes(
+                static_cast<double>(bloom_bits_per_state_)));
+        for (uint64_t fingerprint : slots_)
+            if (fingerprint != kEmpty) bloom_filter_->Insert(fingerprint);
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_FINGERPRINT_SET_H_
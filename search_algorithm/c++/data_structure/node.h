@@ -8,13 +8,88 @@
 #ifndef SEARCH_ALG_DATA_STRUCTURE_NODE_H_
 #define SEARCH_ALG_DATA_STRUCTURE_NODE_H_
 
+#include <cstdint>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "problem.h"
+#include "state_store.h"
+
+/**
+ * @brief Holds the state of a node
+ *
+ * A state that owns heap memory (e.g. a vector grid) can be moved into a
+ * StateStore, after which the slot refers to the stored copy, so the state
+ * is kept once however many structures refer to it. Other states (e.g.
+ * FixedState arrays) always stay in the slot, which then holds nothing
+ * else: interning copies them into the store, as reading them through a
+ * pointer would cost more than the copy.
+ *
+ * @tparam TState Type representing the problem state
+ * @tparam kInline true if the state always stays in the slot
+ */
+template <typename TState,
+          bool kInline = std::is_trivially_copyable<TState>::value>
+class NodeStateSlot {
+   public:
+    explicit NodeStateSlot(TState state) : state_(std::move(state)) {}
+
+    const TState& Get() const { return interned_ ? *interned_ : state_; }
+
+    void Set(TState state) {
+        state_ = std::move(state);
+        interned_ = nullptr;
+    }
+
+    std::pair<uint32_t, bool> Intern(StateStore<TState>* store) {
+        if (interned_) return store->Intern(*interned_);
+
+        std::pair<uint32_t, bool> result = store->Intern(std::move(state_));
+        if (!result.second) return result;  // state_ was not moved from
+
+        state_ = TState();  // Release whatever the moved-from state holds
+        interned_ = &store->Get(result.first);
+        return result;
+    }
+
+    void Detach() {
+        if (!interned_) return;
+        state_ = *interned_;
+        interned_ = nullptr;
+    }
+
+   private:
+    TState state_;  ///< Own state, empty once interned
+    const TState* interned_ = nullptr;  ///< Stored copy, if interned
+};
+
+template <typename TState>
+class NodeStateSlot<TState, true> {
+   public:
+    explicit NodeStateSlot(TState state) : state_(std::move(state)) {}
+
+    const TState& Get() const { return state_; }
+
+    void Set(TState state) { state_ = std::move(state); }
+
+    std::pair<uint32_t, bool> Intern(StateStore<TState>* store) const {
+        return store->Intern(state_);
+    }
+
+    void Detach() {}
+
+   private:
+    TState state_;
+};
 
 /**
  * @brief Represents a node in a search tree
  *
+ * The state is held in a NodeStateSlot: after InternState, a state that
+ * owns heap memory is kept by a StateStore (e.g. the reached set of the
+ * search) and the node refers to it.
+ *
  * @tparam TState Type representing the problem state
  * @tparam TAction Type representing actions that can be taken
  * @tparam CostType Type representing the cost of actions
@@ -59,7 +134,31 @@ class Node
      * @brief Gets the state of this node
      * @return Const reference to the state
      */
-    const TState& GetState() const { return state_; }
+    const TState& GetState() const { return state_.Get(); }
+
+    /**
+     * @brief Adds the state to a store, unless an equal state is there
+     *
+     * A state that owns heap memory is moved into the store and the node
+     * refers to the stored copy, so the store must outlive the node or
+     * DetachState must be called first. Other states are copied and stay
+     * in the node (see NodeStateSlot).
+     *
+     * @param store The store
+     * @return The state's id in the store, and true if it was added; if the
+     * store already held it the node is unchanged
+     */
+    std::pair<uint32_t, bool> InternState(StateStore<TState>* store) {
+        return state_.Intern(store);
+    }
+
+    /**
+     * @brief Copies an interned state back into the node
+     *
+     * Makes the node independent of the store again, e.g. before a search
+     * returns a path while its store goes away.
+     */
+    void DetachState() { state_.Detach(); }
 
     /**
      * @brief Gets the parent node
@@ -75,37 +174,53 @@ class Node
 
     /**
      * @brief Gets the cumulative path cost from root to this node
-     * @return The path cost as a float
+     * @return The path cost
      */
-    float GetPathCost() const { return path_cost_; }
+    CostType GetPathCost() const { return path_cost_; }
 
     /**
      * @brief Gets the depth of this node in the search tree
-     * @return The depth as a uint64_t
+     * @return The depth
      */
-    uint64_t GetDepth() const { return depth_; }
+    uint32_t GetDepth() const { return depth_; }
+
+    /**
+     * @brief Gets the id a trace gave this node
+     * @return The id, 0 if no trace has named the node
+     */
+    uint32_t GetTraceId() const { return trace_id_; }
+
+    /**
+     * @brief Names the node in a trace (see TraceNode)
+     *
+     * Bookkeeping of the trace, not part of the node's value, so it can be
+     * set on a const node.
+     *
+     * @param id The id
+     */
+    void SetTraceId(uint32_t id) const { trace_id_ = id; }
 
    private:
-    TState state_;
+    NodeStateSlot<TState> state_;
     std::shared_ptr<NodeType> parent_;
     TAction action_;
-    float path_cost_;
-    uint64_t depth_;
+    CostType path_cost_;
+    uint32_t depth_;
+    mutable uint32_t trace_id_ = 0;  ///< Fits in the padding after depth_
 
     /**
      * @name Private Setter Methods
      * @warning Using these after construction can break tree integrity
      * @{
      */
-    void SetState(const TState& state) { state_ = state; }
-    void SetState(TState&& state) { state_ = std::move(state); }
+    void SetState(TState state) { state_.Set(std::move(state)); }
     void SetParent(std::shared_ptr<NodeType> parent) {
         parent_ = std::move(parent);
     }
     void SetAction(const TAction& action) { action_ = action; }
     void SetAction(TAction&& action) { action_ = std::move(action); }
     void SetPathCost(CostType path_cost) { path_cost_ = path_cost; }
-    void SetDepth(uint64_t depth) { depth_ = depth; }
+    void SetDepth(uint32_t depth) { depth_ = depth; }
     /// @}
 };
 
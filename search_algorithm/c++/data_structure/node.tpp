@@ -16,8 +16,9 @@ Node<TState, TAction, CostType>::Expand(
     for (const TAction& action : actions) {
         std::unique_ptr<TState> new_state =
             problem.GetResult(current_state, action);
-        float cost = this->GetPathCost() +
-                     problem.GetActionCost(current_state, action, *new_state);
+        CostType cost =
+            this->GetPathCost() +
+            problem.GetActionCost(current_state, action, *new_state);
         children.emplace_back(std::make_shared<NodeType>(
             *new_state, this->shared_from_this(), action, cost));
     }
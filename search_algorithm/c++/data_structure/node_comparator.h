@@ -8,6 +8,8 @@
 #ifndef NODE_COMPARATOR_H
 #define NODE_COMPARATOR_H
 
+#include "static_problem.h"
+
 /**
  * @brief Base class for node comparators
  *
@@ -15,12 +17,14 @@
  * @tparam TState Type representing the problem state
  * @tparam TAction Type representing actions that can be taken
  * @tparam TCostType Type used for path costs (typically int, float, or double)
+ * @tparam TProblem Static type of the problem; a StaticProblem class binds
+ * the problem calls at compile time (see ProblemDispatch)
  */
-template <typename TState, typename TAction, typename TCostType>
+template <typename TState, typename TAction, typename TCostType,
+          typename TProblem = Problem<TState, TAction, TCostType>>
 class NodeComparator {
    public:
-    explicit NodeComparator(Problem<TState, TAction, TCostType> const& problem)
-        : problem_(problem) {}
+    explicit NodeComparator(TProblem const& problem) : problem_(problem) {}
 
     virtual ~NodeComparator() = default;
 
@@ -35,9 +39,8 @@ class NodeComparator {
         std::shared_ptr<Node<TState, TAction, TCostType>> const& rhs) const = 0;
 
    protected:
-    Problem<TState, TAction, TCostType> const&
-        problem_;  ///< Problem reference to access problem details, like
-                   ///< heuristic function, if needed
+    TProblem const& problem_;  ///< Problem reference to access problem
+                               ///< details, like heuristic function, if needed
 };
 
 /**
@@ -62,7 +65,7 @@ class CompareByPathCost : public NodeComparator<TState, TAction, TCostType> {
     bool operator()(
         std::shared_ptr<Node<TState, TAction, TCostType>> const& lhs,
         std::shared_ptr<Node<TState, TAction, TCostType>> const& rhs)
-        const override {
+        const final {
         return lhs->GetPathCost() > rhs->GetPathCost();
     }
 };
@@ -79,17 +82,22 @@ class CompareByPathCost : public NodeComparator<TState, TAction, TCostType> {
  *
  * @note Need to provide a Problem instance in construction to access the
  * heuristic function
+ * @note With TProblem set to a StaticProblem class (e.g.
+ * CompareByAStar<State, Action, ChessCostType, ChessBoardProblem>), the
+ * heuristic is called without the vtable
  */
-template <typename TState, typename TAction, typename TCostType>
-class CompareByAStar : public NodeComparator<TState, TAction, TCostType> {
+template <typename TState, typename TAction, typename TCostType,
+          typename TProblem = Problem<TState, TAction, TCostType>>
+class CompareByAStar
+    : public NodeComparator<TState, TAction, TCostType, TProblem> {
    public:
     /**
      * @brief Constructs the A* comparator with a problem instance
      *
      * @param problem The problem instance containing the heuristic function
      */
-    explicit CompareByAStar(Problem<TState, TAction, TCostType> const& problem)
-        : NodeComparator<TState, TAction, TCostType>(problem) {}
+    explicit CompareByAStar(TProblem const& problem)
+        : NodeComparator<TState, TAction, TCostType, TProblem>(problem) {}
 
     /**
      * @brief Compares two nodes by their A* evaluation function f(n) = g(n) +
@@ -106,11 +114,12 @@ class CompareByAStar : public NodeComparator<TState, TAction, TCostType> {
     bool operator()(
         std::shared_ptr<Node<TState, TAction, TCostType>> const& lhs,
         std::shared_ptr<Node<TState, TAction, TCostType>> const& rhs)
-        const override {
+        const final {
+        using Dispatch = ProblemDispatch<TProblem>;
         TCostType g_lhs = lhs->GetPathCost();
-        TCostType h_lhs = this->problem_.Heuristic(lhs->GetState());
+        TCostType h_lhs = Dispatch::Heuristic(this->problem_, lhs->GetState());
         TCostType g_rhs = rhs->GetPathCost();
-        TCostType h_rhs = this->problem_.Heuristic(rhs->GetState());
+        TCostType h_rhs = Dispatch::Heuristic(this->problem_, rhs->GetState());
         return (g_lhs + h_lhs) > (g_rhs + h_rhs);
     }
 };
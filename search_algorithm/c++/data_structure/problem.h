@@ -9,6 +9,9 @@
 #define SEARCH_ALG_DATA_STRUCTURE_PROBLEM_H_
 
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 /**
@@ -131,6 +134,47 @@ class Problem {
      * @return Heuristic estimate of cost to goal
      */
     virtual CostType Heuristic(const TState& state) const = 0;
+
+    /**
+     * @brief Maps a state to the representative of its symmetry class
+     * (optional override)
+     *
+     * A symmetry here is a one-to-one mapping of states that maps goal states
+     * to goal states and moves to moves of the same cost, so symmetric states
+     * are equally far from a goal and a search only needs to reach one of
+     * them. Searches asked to (SearchOptions::reduce_symmetry) key their
+     * reached sets and transposition tables on the representative; nodes keep
+     * the actual states, so the returned paths are real paths.
+     *
+     * Default implementation returns the state itself (no symmetry).
+     *
+     * @param state The state to map
+     * @return The same representative for every state of the class
+     */
+    virtual TState Canonicalize(const TState& state) const { return state; }
+};
+
+/// Declared only: picks the Problem base of a problem class in decltype
+template <typename TState, typename TAction, typename CostType>
+std::tuple<TState, TAction, CostType>* ProblemBaseTypes(
+    const Problem<TState, TAction, CostType>*);
+
+/**
+ * @brief State, action and cost types of a problem class, read from its
+ * Problem base
+ *
+ * Lets a function template taking the problem's static type (e.g. a search)
+ * still be called without naming the three types.
+ *
+ * @tparam TProblem Problem or a class derived from it
+ */
+template <typename TProblem>
+struct ProblemTypes {
+    using Types = std::remove_pointer_t<decltype(ProblemBaseTypes(
+        std::declval<const TProblem*>()))>;
+    using State = std::tuple_element_t<0, Types>;
+    using Action = std::tuple_element_t<1, Types>;
+    using Cost = std::tuple_element_t<2, Types>;
 };
 
 #endif  // SEARCH_ALG_DATA_STRUCTURE_PROBLEM_H_
\ No newline at end of file
@@ -1,20 +1,39 @@
 #include "chess_board_problem.h"
 
+#include <algorithm>
+#include <array>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <numeric>
 #include <queue>
+#include <random>
 #include <stdexcept>
 
 using namespace chess_board;
 
+std::vector<Square> chess_board::ListPieces(const Board& board) {
+    std::vector<Square> pieces;
+    for (std::size_t r = 0; r < board.size(); ++r) {
+        for (std::size_t c = 0; c < board[r].size(); ++c) {
+            Piece piece = board[r][c];
+            if (piece == Piece::EMPTY || piece == Piece::BORDER ||
+                piece == Piece::ANY)
+                continue;
+            pieces.push_back(
+                Square{static_cast<uint8_t>(r), static_cast<uint8_t>(c)});
+        }
+    }
+    return pieces;
+}
+
 State ChessBoardProblem::GenerateInitialState(const int preset_state) const {
-    State s;
+    Board s;
     switch (preset_state) {
         case 1:
-            s = State(5, std::vector<Piece>(8, Piece::BORDER));
+            s = Board(5, std::vector<Piece>(8, Piece::BORDER));
             for (int i{1}; i <= 4; ++i) {
                 s[2][i] = Piece::WHITE_KNIGHT;
                 s[1][i + 1] = Piece::BISHOP;
@@ -26,10 +45,10 @@ State ChessBoardProblem::GenerateInitialState(const int preset_state) const {
             s[2][6] = Piece::ROOK;
             s[3][5] = Piece::ROOK;
             s[3][6] = Piece::EMPTY;
-            return s;
+            return State(std::move(s));
 
         case 2:
-            s = State(6, std::vector<Piece>(6, Piece::BORDER));
+            s = Board(6, std::vector<Piece>(6, Piece::BORDER));
             for (int i{1}; i <= 4; ++i) {
                 s[1][i] = Piece::WHITE_KNIGHT;
                 s[2][i] = Piece::BISHOP;
@@ -38,7 +57,7 @@ State ChessBoardProblem::GenerateInitialState(const int preset_state) const {
 
             s[4][1] = Piece::EMPTY;
             s[4][4] = Piece::PAWN;
-            return s;
+            return State(std::move(s));
 
         default:
             throw std::logic_error(
@@ -58,245 +77,346 @@ std::unique_ptr<State> ChessBoardProblem::GetResult(
     int toCol = action.toCol;
 
     Piece piece = static_cast<Piece>((*new_state)[row][col]);
-    (*new_state)[row][col] = Piece::EMPTY;  // Empty origin cell
 
     // Special case: pawn promotion
     if (piece == Piece::PAWN &&
         toRow == 1)  // hardcoded toRow 1 makes the pawn a queen
-        (*new_state)[row][col] = Piece::QUEEN;
-    else
-        (*new_state)[toRow][toCol] = piece;
+        PlacePiece(*new_state, row, col, Piece::QUEEN);
+    else {
+        PlacePiece(*new_state, row, col, Piece::EMPTY);  // Empty origin cell
+        PlacePiece(*new_state, toRow, toCol, piece);
+
+        // The promoted pawn stays on its square, anything else moves
+        for (Square& square : new_state->pieces) {
+            if (square.row == row && square.col == col) {
+                square = Square{static_cast<uint8_t>(toRow),
+                                static_cast<uint8_t>(toCol)};
+                break;
+            }
+        }
+    }
 
     return new_state;
 }
 
+namespace {
+
+// Index of every Piece value in the Zobrist key table
+constexpr std::array<uint8_t, 128> kPieceKind = [] {
+    const Piece pieces[] = {Piece::EMPTY,  Piece::BORDER, Piece::ANY,
+                            Piece::ROOK,   Piece::PAWN,   Piece::QUEEN,
+                            Piece::BISHOP, Piece::WHITE_KNIGHT,
+                            Piece::BLACK_KNIGHT};
+    std::array<uint8_t, 128> kinds{};
+    for (std::size_t kind = 0; kind < std::size(pieces); ++kind)
+        kinds[pieces[kind]] = static_cast<uint8_t>(kind);
+    return kinds;
+}();
+
+}  // namespace
+
+uint64_t ChessBoardProblem::ComputeHash(const State& state) const {
+    uint64_t hash = 0;
+    for (int r = 0; r < board_height_; ++r)
+        for (int c = 0; c < board_width_; ++c)
+            hash ^= GetZobristKey(r, c, state[r][c]);
+    return hash;
+}
+
+std::vector<uint64_t> ChessBoardProblem::GenerateZobristKeys() const {
+    std::mt19937_64 rng(0x5A0B2157C4E55ULL);
+    std::vector<uint64_t> keys(board_height_ * board_width_ * kNumPieceKinds);
+    for (uint64_t& key : keys) key = rng();
+    return keys;
+}
+
+uint64_t ChessBoardProblem::GetZobristKey(int row, int col,
+                                          Piece piece) const {
+    int kind = kPieceKind[static_cast<unsigned char>(piece) & 0x7F];
+    return zobrist_keys_[(row * board_width_ + col) * kNumPieceKinds + kind];
+}
+
+void ChessBoardProblem::PlacePiece(State& state, int row, int col,
+                                   Piece piece) const {
+    state.hash ^= GetZobristKey(row, col, state[row][col]) ^
+                  GetZobristKey(row, col, piece);
+    state[row][col] = piece;
+}
+
 std::vector<Action> ChessBoardProblem::GetActions(const State& state) const {
     std::vector<Action> actions;
 
     int num_rows = state.size();
     int num_cols = state[0].size();
 
-    for (int row = 0; row < num_rows; ++row)
-        for (int col = 0; col < num_cols; ++col) {
-            Piece piece_to_move = state[row][col];
-
-            // Map all possible moves
-            switch (piece_to_move) {
-                case Piece::WHITE_KNIGHT:
-                case Piece::BLACK_KNIGHT: {
-                    const int row_move[8] = {-2, -2, -1, -1, 1, 1, 2, 2};
-                    const int col_move[8] = {-1, 1, -2, 2, -2, 2, -1, 1};
-                    for (int i{0}; i < 8; ++i) {
-                        int dest_row = row + row_move[i];
-                        int dest_col = col + col_move[i];
-                        if (dest_row >= 0 && dest_row < num_rows &&
-                            dest_col >= 0 && dest_col < num_cols &&
-                            state[dest_row][dest_col] == Piece::EMPTY)
-                            actions.emplace_back(piece_to_move, row, col,
-                                                 dest_row, dest_col);
-                    }
-                    break;
+    // Only squares holding a piece, never empty or border ones
+    for (const Square& square : state.pieces) {
+        int row = square.row, col = square.col;
+        Piece piece_to_move = state[row][col];
+
+        // Map all possible moves
+        switch (piece_to_move) {
+            case Piece::WHITE_KNIGHT:
+            case Piece::BLACK_KNIGHT: {
+                const int row_move[8] = {-2, -2, -1, -1, 1, 1, 2, 2};
+                const int col_move[8] = {-1, 1, -2, 2, -2, 2, -1, 1};
+                for (int i{0}; i < 8; ++i) {
+                    int dest_row = row + row_move[i];
+                    int dest_col = col + col_move[i];
+                    if (dest_row >= 0 && dest_row < num_rows &&
+                        dest_col >= 0 && dest_col < num_cols &&
+                        state[dest_row][dest_col] == Piece::EMPTY)
+                        actions.emplace_back(piece_to_move, row, col,
+                                             dest_row, dest_col);
                 }
-                case Piece::ROOK: {
-                    const int row_move[4] = {-1, 1, 0, 0};
-                    const int col_move[4] = {0, 0, -1, 1};
-                    for (int i = 0; i < 4; ++i) {
-                        int dest_row = row, dest_col = col;
-                        while (true) {
-                            dest_row += row_move[i];
-                            dest_col += col_move[i];
-                            if (dest_row < 0 || dest_row >= num_rows ||
-                                dest_col < 0 || dest_col >= num_cols ||
-                                state[dest_row][dest_col] != EMPTY)
-                                break;
-
-                            actions.emplace_back(piece_to_move, row, col,
-                                                 dest_row, dest_col);
-                        }
+                break;
+            }
+            case Piece::ROOK: {
+                const int row_move[4] = {-1, 1, 0, 0};
+                const int col_move[4] = {0, 0, -1, 1};
+                for (int i = 0; i < 4; ++i) {
+                    int dest_row = row, dest_col = col;
+                    while (true) {
+                        dest_row += row_move[i];
+                        dest_col += col_move[i];
+                        if (dest_row < 0 || dest_row >= num_rows ||
+                            dest_col < 0 || dest_col >= num_cols ||
+                            state[dest_row][dest_col] != EMPTY)
+                            break;
+
+                        actions.emplace_back(piece_to_move, row, col,
+                                             dest_row, dest_col);
                     }
-                    break;
                 }
-                case Piece::BISHOP: {
-                    const int row_move[4] = {-1, -1, 1, 1};
-                    const int col_move[4] = {-1, 1, -1, 1};
-                    for (int i = 0; i < 4; ++i) {
-                        int dest_row = row;
-                        int dest_col = col;
-                        while (true) {
-                            dest_row += row_move[i];
-                            dest_col += col_move[i];
-                            if (dest_row < 0 || dest_row >= num_rows ||
-                                dest_col < 0 || dest_col >= num_cols ||
-                                state[dest_row][dest_col] != Piece::EMPTY)
-                                break;
-
-                            actions.emplace_back(piece_to_move, row, col,
-                                                 dest_row, dest_col);
-                        }
+                break;
+            }
+            case Piece::BISHOP: {
+                const int row_move[4] = {-1, -1, 1, 1};
+                const int col_move[4] = {-1, 1, -1, 1};
+                for (int i = 0; i < 4; ++i) {
+                    int dest_row = row;
+                    int dest_col = col;
+                    while (true) {
+                        dest_row += row_move[i];
+                        dest_col += col_move[i];
+                        if (dest_row < 0 || dest_row >= num_rows ||
+                            dest_col < 0 || dest_col >= num_cols ||
+                            state[dest_row][dest_col] != Piece::EMPTY)
+                            break;
+
+                        actions.emplace_back(piece_to_move, row, col,
+                                             dest_row, dest_col);
                     }
-                    break;
                 }
-                case Piece::QUEEN: {
-                    const int row_move[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
-                    const int col_move[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
-                    for (int i = 0; i < 8; ++i) {
-                        int dest_row = row;
-                        int dest_col = col;
-                        while (true) {
-                            dest_row += row_move[i];
-                            dest_col += col_move[i];
-                            if (dest_row < 0 || dest_row >= num_rows ||
-                                dest_col < 0 || dest_col >= num_cols ||
-                                state[dest_row][dest_col] != Piece::EMPTY)
-                                break;
-
-                            actions.emplace_back(piece_to_move, row, col,
-                                                 dest_row, dest_col);
-                        }
+                break;
+            }
+            case Piece::QUEEN: {
+                const int row_move[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+                const int col_move[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+                for (int i = 0; i < 8; ++i) {
+                    int dest_row = row;
+                    int dest_col = col;
+                    while (true) {
+                        dest_row += row_move[i];
+                        dest_col += col_move[i];
+                        if (dest_row < 0 || dest_row >= num_rows ||
+                            dest_col < 0 || dest_col >= num_cols ||
+                            state[dest_row][dest_col] != Piece::EMPTY)
+                            break;
+
+                        actions.emplace_back(piece_to_move, row, col,
+                                             dest_row, dest_col);
                     }
-                    break;
-                }
-                case Piece::PAWN: {
-                    int dest_row = row - 1;  // pawn moving up
-                    if (dest_row >= 0 && dest_row < num_rows)
-                        if (state[dest_row][col] == Piece::EMPTY)
-                            actions.emplace_back(piece_to_move, row, col,
-                                                 dest_row, col);
-                    break;
                 }
-
-                case Piece::EMPTY:
-                case Piece::BORDER:
-                case Piece::ANY:
-                    break;  // No moves for these pieces
+                break;
+            }
+            case Piece::PAWN: {
+                int dest_row = row - 1;  // pawn moving up
+                if (dest_row >= 0 && dest_row < num_rows)
+                    if (state[dest_row][col] == Piece::EMPTY)
+                        actions.emplace_back(piece_to_move, row, col,
+                                             dest_row, col);
+                break;
             }
+
+            case Piece::EMPTY:
+            case Piece::BORDER:
+            case Piece::ANY:
+                break;  // No moves for these pieces
         }
+    }
 
     return actions;
 }
 
-auto knight_next_jump(int knight_r, int knight_c, int board_height,
-                      int board_width) -> std::vector<std::pair<int, int>> {
-    // Deslocamentos fixos do cavalo (dr, dc)
-    std::vector<std::pair<int, int>> moves = {
-        {-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}};
-
-    std::vector<std::pair<int, int>> possible_squares;
-
-    for (const auto& move : moves) {
-        int new_r = knight_r + move.first;
-        int new_c = knight_c + move.second;
-
-        if (new_r >= 0 && new_r < board_height && new_c >= 0 &&
-            new_c < board_width) {
-            possible_squares.push_back({new_r, new_c});
-        }
+namespace {
+
+// Row of the pawn promotion, hardcoded in GetResult
+constexpr int kPromotionRow = 1;
+
+/**
+ * @brief Move steps of a piece type
+ * @param piece The piece type
+ * @param out_slides Output: true if the piece repeats its step until blocked
+ * @return (row, col) steps, empty for pieces that cannot move
+ */
+std::vector<std::pair<int, int>> GetMoveSteps(Piece piece, bool* out_slides) {
+    *out_slides = true;
+    switch (piece) {
+        case Piece::WHITE_KNIGHT:
+        case Piece::BLACK_KNIGHT:
+            *out_slides = false;
+            return {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2},
+                    {1, -2},  {1, 2},  {2, -1},  {2, 1}};
+        case Piece::ROOK:
+            return {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+        case Piece::BISHOP:
+            return {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+        case Piece::QUEEN:
+            return {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1},
+                    {0, 1},   {1, -1}, {1, 0},  {1, 1}};
+        default:
+            return {};
     }
-
-    return possible_squares;
 }
 
-std::vector<std::vector<ChessCostType>>
-ChessBoardProblem::GenerateKnightLookupTable(int goal_r, int goal_c) {
-    const ChessCostType UNVISITED = std::numeric_limits<ChessCostType>::max();
-    std::vector<std::vector<ChessCostType>> LookupTable(
-        board_height_, std::vector<ChessCostType>(board_width_, UNVISITED));
-
-    std::pair<int, int> coordinates;
-    std::vector<std::pair<int, int>> next_squares;
-
-    std::queue<std::pair<int, int>> tree;
-
-    ChessCostType current_value;
-
-    LookupTable[goal_r][goal_c] = static_cast<ChessCostType>(0.0);
-    tree.push({goal_r, goal_c});
-
-    while (!tree.empty()) {
-        std::pair<int, int> coordinates = tree.front();
-        tree.pop();
-
-        current_value = LookupTable[coordinates.first][coordinates.second];
-        next_squares = knight_next_jump(coordinates.first, coordinates.second,
-                                        board_height_, board_width_);
+}  // namespace
+
+std::vector<ChessCostType> ChessBoardProblem::GenerateDistanceTable(
+    Piece piece, int goal_r, int goal_c) const {
+    std::vector<ChessCostType> table(board_height_ * board_width_,
+                                     kUnreachable);
+    auto is_open = [&](int r, int c) {
+        return r >= 0 && r < board_height_ && c >= 0 && c < board_width_ &&
+               goal_state_[r][c] != Piece::BORDER;
+    };
+
+    table[goal_r * board_width_ + goal_c] = 0.0;
+
+    // Pawns only move up, so walking backwards from the goal means walking
+    // down the column
+    if (piece == Piece::PAWN) {
+        for (int r = goal_r + 1; is_open(r, goal_c); ++r)
+            table[r * board_width_ + goal_c] =
+                static_cast<ChessCostType>(r - goal_r);
+        return table;
+    }
 
-        for (const auto& square : next_squares) {
-            if (LookupTable[square.first][square.second] == UNVISITED) {
-                LookupTable[square.first][square.second] = current_value + 1.0;
-                tree.push(square);
+    // The other pieces move symmetrically (with BORDER as the only obstacle
+    // a slide can be reversed), so a forward BFS from the goal is enough
+    bool slides = false;
+    std::vector<std::pair<int, int>> steps = GetMoveSteps(piece, &slides);
+
+    std::queue<std::pair<int, int>> squares;
+    squares.push({goal_r, goal_c});
+
+    while (!squares.empty()) {
+        auto [r, c] = squares.front();
+        squares.pop();
+        ChessCostType next_value = table[r * board_width_ + c] + 1;
+
+        for (const auto& [dr, dc] : steps) {
+            int dest_r = r + dr, dest_c = c + dc;
+            while (is_open(dest_r, dest_c)) {
+                ChessCostType& cell = table[dest_r * board_width_ + dest_c];
+                if (cell == kUnreachable) {
+                    cell = next_value;
+                    squares.push({dest_r, dest_c});
+                }
+                if (!slides) break;
+                dest_r += dr;
+                dest_c += dc;
             }
         }
     }
 
-    return LookupTable;
+    return table;
 }
 
-ChessCostType ChessBoardProblem::Heuristic(const State& state) const {
-    const int rows = static_cast<int>(state.size());
-    const int cols = rows ? static_cast<int>(state[0].size()) : 0;
-
-    if (rows == 0 || cols == 0) return static_cast<ChessCostType>(0.0);
-    if (IsGoal(state)) return static_cast<ChessCostType>(0.0);
-
-    const ChessCostType UNVISITED = std::numeric_limits<ChessCostType>::max();
-
-    // Identify which problem it is based on preset_state_
-    bool isProblem1 = (preset_state_ == 1);
-    bool isProblem2 = (preset_state_ == 2);
-
-    // Admissible heuristic for Problem 1: Black knight at (3,6)
-    if (isProblem1) {
-        auto [knight_r, knight_c] =
-            FindPiecePosition(state, Piece::BLACK_KNIGHT);
-
-        if (knight_r == -1) return static_cast<ChessCostType>(0.0);
+std::vector<ChessCostType> ChessBoardProblem::GeneratePromotionTable(
+    const std::vector<ChessCostType>& queen_distance) const {
+    std::vector<ChessCostType> table(board_height_ * board_width_,
+                                     kUnreachable);
+
+    // GetResult promotes a pawn moving into kPromotionRow and leaves the
+    // queen on the square the pawn moved from
+    const int queen_row = kPromotionRow + 1;
+    if (queen_row >= board_height_) return table;
+
+    for (int c = 0; c < board_width_; ++c) {
+        if (goal_state_[kPromotionRow][c] == Piece::BORDER) continue;
+
+        ChessCostType promoted =
+            1 + queen_distance[queen_row * board_width_ + c];
+        for (int r = queen_row;
+             r < board_height_ && goal_state_[r][c] != Piece::BORDER; ++r)
+            table[r * board_width_ + c] =
+                static_cast<ChessCostType>(r - queen_row) + promoted;
+    }
 
-        if (knight_r >= 0 && knight_r < board_height_ && knight_c >= 0 &&
-            knight_c < board_width_)
-            return knight_lookup_table_[knight_r][knight_c];
+    return table;
+}
 
-        return static_cast<ChessCostType>(0.0);
+std::vector<ChessBoardProblem::GoalTarget>
+ChessBoardProblem::GenerateGoalTargets() const {
+    std::vector<GoalTarget> targets;
+
+    for (int r = 0; r < board_height_; ++r) {
+        for (int c = 0; c < board_width_; ++c) {
+            Piece piece = goal_state_[r][c];
+            if (piece == Piece::ANY || piece == Piece::BORDER ||
+                piece == Piece::EMPTY)
+                continue;
+
+            GoalTarget target;
+            target.piece = piece;
+            target.row = r;
+            target.col = c;
+            target.piece_distance = GenerateDistanceTable(piece, r, c);
+            if (piece == Piece::QUEEN)
+                target.pawn_distance =
+                    GeneratePromotionTable(target.piece_distance);
+
+            for (int i = 0; i < board_height_ * board_width_; ++i)
+                if (target.piece_distance[i] != kUnreachable ||
+                    (!target.pawn_distance.empty() &&
+                     target.pawn_distance[i] != kUnreachable))
+                    target.sources.push_back(i);
+            targets.push_back(std::move(target));
+        }
     }
 
-    // Admissible heuristic for Problem 2: Pawn → Queen → (4,1)
-    if (isProblem2) {
-        const int promotion_row = 1;
-        const int queen_goal_r = 4, queen_goal_c = 1;
+    return targets;
+}
 
-        auto [queen_r, queen_c] = FindPiecePosition(state, Piece::QUEEN);
-        auto [pawn_r, pawn_c] = FindPiecePosition(state, Piece::PAWN);
+ChessCostType ChessBoardProblem::GetTargetDistance(std::size_t target,
+                                                   Piece piece, int row,
+                                                   int col) const {
+    const GoalTarget& goal = goal_targets_[target];
+    std::size_t index = row * board_width_ + col;
 
-        // Phase 2: Queen exists
-        if (queen_r != -1) {
-            int dr = abs(queen_r - queen_goal_r);
-            int dc = abs(queen_c - queen_goal_c);
+    if (piece == goal.piece) return goal.piece_distance[index];
+    if (piece == Piece::PAWN && !goal.pawn_distance.empty())
+        return goal.pawn_distance[index];
+    return kUnreachable;
+}
 
-            // Admissible heuristic for Queen (Chebyshev distance)
-            ChessCostType h = static_cast<ChessCostType>(std::max(dr, dc));
-            return h;
-        }
-        // Phase 1: Pawn exists
-        else if (pawn_r != -1) {
-            // Minimum cost for pawn to reach promotion row
-            // This is a guaranteed underestimate
-            ChessCostType pawn_cost =
-                static_cast<ChessCostType>(pawn_r - promotion_row);
-
-            // Absolute minimum cost for queen (Chebyshev distance)
-            int dr = abs(promotion_row - queen_goal_r);
-            int dc = abs(pawn_c - queen_goal_c);
-            ChessCostType queen_cost =
-                static_cast<ChessCostType>(std::max(dr, dc));
-
-            // Sum of admissible heuristics is admissible
-            return pawn_cost + queen_cost;
-        }
+ChessCostType ChessBoardProblem::Heuristic(const State& state) const {
+    if (goal_targets_.empty()) return static_cast<ChessCostType>(0.0);
+
+    std::vector<ChessCostType> best(goal_targets_.size(), kUnreachable);
 
-        return static_cast<ChessCostType>(0.0);
+    for (const Square& square : state.pieces) {
+        Piece piece = state[square.row][square.col];
+        for (std::size_t t = 0; t < goal_targets_.size(); ++t)
+            best[t] = std::min(best[t], GetTargetDistance(t, piece, square.row,
+                                                          square.col));
     }
 
-    // Default case: admissible heuristic, but not informative
-    return static_cast<ChessCostType>(0.0);
+    // Every goal square needs its own piece, and every move moves one piece
+    ChessCostType total = 0.0;
+    for (ChessCostType distance : best) total += distance;
+    return total;
 }
 
 void ChessBoardProblem::PrintState(const State& state) const {
@@ -307,43 +427,81 @@ void ChessBoardProblem::PrintState(const State& state) const {
     std::cout << std::endl;
 }
 
+uint64_t CompiledGoal::Load(const std::vector<Piece>& row, const Word& word) {
+    uint64_t value = 0;
+    std::memcpy(&value, row.data() + word.col, word.length);
+    return value;
+}
+
+bool CompiledGoal::Matches(const State& state) const {
+    for (const Word& word : words)
+        if ((Load(state[word.row], word) & word.mask) != word.expected)
+            return false;
+    return true;
+}
+
 bool ChessBoardProblem::IsGoal(const State& state) const {
-    int rows = goal_state_.size();
-    int cols = goal_state_[0].size();
+    return compiled_goal_.Matches(state);
+}
+
+CompiledGoal ChessBoardProblem::CompileGoal() const {
+    static_assert(sizeof(Piece) == 1, "Goal words pack one piece per byte");
+    constexpr int kCellsPerWord = sizeof(uint64_t);
 
-    for (int r = 0; r < rows; ++r) {
-        for (int c = 0; c < cols; ++c) {
-            auto goal_cell = goal_state_[r][c];
-            auto curr_cell = state[r][c];
+    CompiledGoal compiled;
+    for (int r = 0; r < board_height_; ++r) {
+        for (int c = 0; c < board_width_; c += kCellsPerWord) {
+            CompiledGoal::Word word{r, c,
+                                    std::min(kCellsPerWord, board_width_ - c),
+                                    0, 0};
+            word.expected = CompiledGoal::Load(goal_state_[r], word);
 
-            if (goal_cell == Piece::ANY) continue;  // ignora '?'
-            if (curr_cell != goal_cell) return false;
+            for (int i = 0; i < word.length; ++i)
+                if (goal_state_[r][c + i] != Piece::ANY)
+                    word.mask |= uint64_t{0xFF} << (8 * i);
+            word.expected &= word.mask;
+
+            if (word.mask != 0) compiled.words.push_back(word);
         }
     }
+    return compiled;
+}
 
+bool ChessBoardProblem::IsGoalReachable(const State& state) const {
+    for (std::size_t t = 0; t < goal_targets_.size(); ++t) {
+        bool reachable = false;
+        for (int index : goal_targets_[t].sources) {
+            int r = index / board_width_, c = index % board_width_;
+            if (GetTargetDistance(t, state[r][c], r, c) != kUnreachable) {
+                reachable = true;
+                break;
+            }
+        }
+        if (!reachable) return false;
+    }
     return true;
 }
 
 State ChessBoardProblem::GenerateGoalState(const int preset_state) const {
-    State s;
+    Board s;
     switch (preset_state) {
         case 1:
-            s = State(5, std::vector<Piece>(8, Piece::BORDER));
+            s = Board(5, std::vector<Piece>(8, Piece::BORDER));
             for (int i{1}; i <= 2; ++i)
                 for (int j{1}; j <= 6; ++j) s[i][j] = Piece::ANY;
 
             s[3][5] = Piece::ANY;
             s[3][6] = Piece::BLACK_KNIGHT;
-            return s;
+            return State(std::move(s));
 
         case 2:
-            s = State(6, std::vector<Piece>(6, Piece::BORDER));
+            s = Board(6, std::vector<Piece>(6, Piece::BORDER));
             for (int i{1}; i <= 3; ++i)
                 for (int j{1}; j <= 4; ++j) s[i][j] = Piece::ANY;
 
             s[4][4] = Piece::ANY;
             s[4][1] = Piece::QUEEN;
-            return s;
+            return State(std::move(s));
 
         default:
             throw std::logic_error(
@@ -362,13 +520,8 @@ void ChessBoardProblem::PrintAction(const Action& action) const {
 
 std::pair<int, int> ChessBoardProblem::FindPiecePosition(
     const State& state, Piece piece_to_find) const {
-    for (size_t r = 0; r < state.size(); ++r) {
-        for (size_t c = 0; c < state[r].size(); ++c) {
-            if (static_cast<Piece>(state[r][c]) == piece_to_find) {
-                return {static_cast<int>(r),
-                        static_cast<int>(c)};  // Piece found
-            }
-        }
-    }
+    for (const Square& square : state.pieces)
+        if (state[square.row][square.col] == piece_to_find)
+            return {square.row, square.col};  // Piece found
     return {-1, -1};  // Piece not found
 }
\ No newline at end of file
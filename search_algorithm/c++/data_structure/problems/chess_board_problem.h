@@ -1,10 +1,14 @@
 #ifndef SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_CHESS_BOARD_H_
 #define SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_CHESS_BOARD_H_
 
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 #include "data_structure/node.h"
 #include "data_structure/problem.h"
+#include "data_structure/serializer.h"
+#include "data_structure/static_problem.h"
 
 namespace chess_board {
 
@@ -45,18 +49,119 @@ struct Action {
     int fromRow, fromCol, toRow, toCol;
 };
 
-using State = std::vector<std::vector<Piece>>;  /// < 2D grid representation
+using Board = std::vector<std::vector<Piece>>;  /// < 2D grid representation
+
+/**
+ * @brief Board square, for boards of at most 256 rows and columns
+ */
+struct Square {
+    uint8_t row;
+    uint8_t col;
+};
+
+/**
+ * @brief Lists the squares holding a piece (not EMPTY, BORDER or ANY)
+ * @param board The board
+ * @return The squares, row by row
+ */
+std::vector<Square> ListPieces(const Board& board);
+
+/**
+ * @brief Board plus its piece list and Zobrist key
+ *
+ * The piece list and the key are kept up to date by
+ * ChessBoardProblem::GetResult, which only touches the squares a move
+ * changes. Move generation and the heuristic walk the piece list instead of
+ * the board, and reached sets and transposition tables hash a state without
+ * reading the board (see StateHash).
+ *
+ * Only the board takes part in comparisons: the order of the piece list
+ * depends on the moves that led to the state.
+ *
+ * @note States built by hand start with key 0, which equality treats as
+ * unknown; use ChessBoardProblem::ComputeHash to key them.
+ */
+struct State {
+    State() = default;
+    explicit State(Board board, uint64_t hash = 0)
+        : board(std::move(board)),
+          pieces(ListPieces(this->board)),
+          hash(hash) {}
+
+    Board board;                 ///< Pieces, row by row
+    std::vector<Square> pieces;  ///< Squares holding a piece, see ListPieces
+    uint64_t hash = 0;           ///< Zobrist key of board
+
+    uint64_t GetHash() const { return hash; }
+
+    std::size_t size() const { return board.size(); }
+    Board::const_iterator begin() const { return board.begin(); }
+    Board::const_iterator end() const { return board.end(); }
+    std::vector<Piece>& operator[](std::size_t row) { return board[row]; }
+    const std::vector<Piece>& operator[](std::size_t row) const {
+        return board[row];
+    }
+
+    // Different keys reject without reading the boards, but only when both
+    // states are keyed
+    bool operator==(const State& other) const {
+        if (hash != other.hash && hash != 0 && other.hash != 0) return false;
+        return board == other.board;
+    }
+    bool operator!=(const State& other) const { return !(*this == other); }
+    bool operator<(const State& other) const { return board < other.board; }
+};
 
 using ChessCostType =
     float;  ///< Cost type for actions and to calculate heuristics
 
+/// Distance of squares from which a piece can never reach its goal square
+constexpr ChessCostType kUnreachable =
+    std::numeric_limits<ChessCostType>::infinity();
+
+/**
+ * @brief Goal pattern compiled into masked 64-bit words
+ *
+ * Each word covers up to 8 consecutive cells of one board row. A cell the
+ * goal constrains has 0xFF in the mask and its required piece in the expected
+ * value; ANY cells are zero in both, and words without constrained cells are
+ * dropped.
+ */
+struct CompiledGoal {
+    struct Word {
+        int row;            ///< Board row the word covers
+        int col;            ///< First column of the word
+        int length;         ///< Cells covered, at most 8
+        uint64_t mask;      ///< 0xFF per constrained cell
+        uint64_t expected;  ///< Required pieces under the mask
+    };
+
+    std::vector<Word> words;  ///< Words holding at least one constraint
+
+    /**
+     * @brief Loads the cells a word covers from a board row
+     * @param row The board row
+     * @param word The word to load
+     * @return Cells packed as bytes, unused bytes zero
+     */
+    static uint64_t Load(const std::vector<Piece>& row, const Word& word);
+
+    /**
+     * @brief Checks a state against the pattern
+     * @param state The state to check
+     * @return true if every constrained cell holds its required piece
+     */
+    bool Matches(const State& state) const;
+};
+
 /**
  * @brief Chess path finding puzzle problem implementation
  * @tparam State State representation as a 2D grid of pieces
  * @tparam Action Action representation for moving pieces
  * @tparam ChessCostType Cost type for actions and heuristics
  */
-class ChessBoardProblem : public Problem<State, Action, ChessCostType> {
+class ChessBoardProblem
+    : public StaticProblem<ChessBoardProblem, State, Action, ChessCostType> {
    public:
     /**
      * @brief Constructs the problem with specified problem identifier
@@ -66,23 +171,26 @@ class ChessBoardProblem : public Problem<State, Action, ChessCostType> {
      *                     - 0: Use random solvable board (not implemented)
      */
     ChessBoardProblem(int preset_state = 0)
-        : Problem<State, Action, ChessCostType>(
+        : StaticProblem<ChessBoardProblem, State, Action, ChessCostType>(
               GenerateInitialState(preset_state)),
           goal_state_(GenerateGoalState(preset_state)),
           preset_state_(preset_state),
           board_height_(initial_state_.size()),
-          board_width_(initial_state_[0].size()) {
-        // Initialize knight heuristic lookup table in problem 1
-        if (preset_state_ == 1) {
-            int goal_row_knight = 3;
-            int goal_col_knight = 6;
-            knight_lookup_table_ =
-                GenerateKnightLookupTable(goal_row_knight, goal_col_knight);
-        }
+          board_width_(initial_state_[0].size()),
+          zobrist_keys_(GenerateZobristKeys()),
+          goal_targets_(GenerateGoalTargets()),
+          compiled_goal_(CompileGoal()) {
+        initial_state_.hash = ComputeHash(initial_state_);
+        goal_state_.hash = ComputeHash(goal_state_);
     }
 
     virtual ~ChessBoardProblem() = default;
 
+    /**
+     * @brief Checks the state against the compiled goal pattern
+     * @param state The state to check
+     * @return true if the state matches the goal
+     */
     virtual bool IsGoal(const State& state) const override;
 
     virtual std::vector<Action> GetActions(const State& state) const override;
@@ -95,8 +203,67 @@ class ChessBoardProblem : public Problem<State, Action, ChessCostType> {
         return 1.0;  // Uniform cost for all actions
     }
 
+    /**
+     * @brief Admissible heuristic from the precomputed distance tables
+     *
+     * For every square the goal requires a piece on, takes the fewest moves
+     * any suitable piece on the board needs to get there (a pawn counts for
+     * a queen square through its promotion), and sums them: each move moves
+     * a single piece and each piece ends on at most one goal square.
+     *
+     * @param state The state to evaluate
+     * @return Lower bound on the moves to the goal, kUnreachable if a goal
+     * square can no longer be filled
+     */
     ChessCostType Heuristic(const State& state) const override;
 
+    /**
+     * @brief Gets the number of goal squares that require a piece
+     * @return Number of precomputed distance tables
+     */
+    std::size_t GetNumGoalTargets() const { return goal_targets_.size(); }
+
+    /**
+     * @brief Moves a piece needs to reach a goal square, ignoring other pieces
+     *
+     * @param target Index of the goal square, below GetNumGoalTargets()
+     * @param piece The piece standing on (row, col)
+     * @param row Row of the piece
+     * @param col Column of the piece
+     * @return Move count, kUnreachable if the piece can never fill the square
+     */
+    ChessCostType GetTargetDistance(std::size_t target, Piece piece, int row,
+                                    int col) const;
+
+    /**
+     * @brief Computes the Zobrist key of a board from scratch
+     *
+     * Only needed for states built outside the problem; GetResult updates the
+     * key of its result incrementally.
+     *
+     * @param state The state to hash (its current key is ignored)
+     * @return XOR of the keys of every (square, piece) pair on the board
+     */
+    uint64_t ComputeHash(const State& state) const;
+
+    /**
+     * @brief Gets the goal pattern IsGoal tests against
+     * @return The compiled goal
+     */
+    const CompiledGoal& GetCompiledGoal() const { return compiled_goal_; }
+
+    /**
+     * @brief Checks that every required goal square can still be filled
+     *
+     * Cheap dead-end test for pruning: fails as soon as a goal square has no
+     * piece on the board that could ever reach it, without computing the
+     * heuristic sum.
+     *
+     * @param state The state to check
+     * @return false if some goal square is impossible to fill
+     */
+    bool IsGoalReachable(const State& state) const;
+
     State GetGoalState() const { return goal_state_; }
 
     void PrintState(const State& state) const;
@@ -114,8 +281,34 @@ class ChessBoardProblem : public Problem<State, Action, ChessCostType> {
     int preset_state_;  /// < Identifier of the statement problem (1 or 2)
     int board_height_;  /// < Height of the chess board
     int board_width_;   /// < Width of the chess board
-    std::vector<std::vector<ChessCostType>>
-        knight_lookup_table_;  ///< Heuristic table for knight moves
+
+    static constexpr int kNumPieceKinds = 9;  ///< Values of Piece
+    std::vector<uint64_t>
+        zobrist_keys_;  ///< Random key per (square, piece kind) pair
+
+    /**
+     * @brief Precomputed distances toward one square the goal requires a
+     * piece on
+     *
+     * Tables are indexed by row * board_width_ + col and built by BFS over
+     * the BORDER layout; other pieces are ignored, so values are lower bounds.
+     */
+    struct GoalTarget {
+        Piece piece;  ///< Piece the goal requires on the square
+        int row;      ///< Goal square row
+        int col;      ///< Goal square column
+        std::vector<ChessCostType>
+            piece_distance;  ///< Moves for piece from each square
+        std::vector<ChessCostType>
+            pawn_distance;  ///< Moves for a pawn promoting into piece, empty
+                            ///< if piece is not a queen
+        std::vector<int>
+            sources;  ///< Squares from which piece or a pawn can reach it
+    };
+
+    std::vector<GoalTarget>
+        goal_targets_;            ///< One entry per required goal square
+    CompiledGoal compiled_goal_;  ///< Goal pattern used by IsGoal
 
     /**
      * @brief Generates the initial state based on preset configuration
@@ -136,7 +329,7 @@ class ChessBoardProblem : public Problem<State, Action, ChessCostType> {
 
     /**
      * @brief Auxiliary function to find the position of a specific piece on the
-     * board
+     * board, from its piece list
      * @param state The current board state to search
      * @param piece_to_find The piece to locate on the board
      * @return std::pair<int, int> The (row, col) position of the piece, or (-1,
@@ -146,15 +339,89 @@ class ChessBoardProblem : public Problem<State, Action, ChessCostType> {
                                           Piece piece_to_find) const;
 
     /**
-     * @brief Generates a lookup table for knight moves to be used as heuristic
-     * @param goal_r The goal row position for the knight
-     * @param goal_c The goal column position for the knight
-     * @return 2D vector representing the lookup table with costs
+     * @brief Generates the Zobrist keys from a fixed seed
+     *
+     * The seed is constant so keys, and thus state hashes, are reproducible
+     * across runs.
+     *
+     * @return kNumPieceKinds keys per square
+     */
+    std::vector<uint64_t> GenerateZobristKeys() const;
+
+    /**
+     * @brief Gets the Zobrist key of a piece on a square
+     * @param row Square row
+     * @param col Square column
+     * @param piece The piece
+     * @return The key
      */
-    std::vector<std::vector<ChessCostType>> GenerateKnightLookupTable(
-        int goal_r, int goal_c);
+    uint64_t GetZobristKey(int row, int col, Piece piece) const;
+
+    /**
+     * @brief Puts a piece on a square and updates the state key
+     * @param state The state to modify
+     * @param row Square row
+     * @param col Square column
+     * @param piece The new content of the square
+     */
+    void PlacePiece(State& state, int row, int col, Piece piece) const;
+
+    /**
+     * @brief Compiles goal_state_ into masked words
+     * @return The compiled goal
+     */
+    CompiledGoal CompileGoal() const;
+
+    /**
+     * @brief Builds the distance tables for every required goal square
+     * @return One GoalTarget per goal cell holding a piece
+     */
+    std::vector<GoalTarget> GenerateGoalTargets() const;
+
+    /**
+     * @brief Generates the move-count table of a piece toward a square
+     *
+     * BFS from the goal square following the piece's moves backwards. Sliding
+     * pieces stop at BORDER cells and the board edge, the pawn only moves up.
+     *
+     * @param piece The piece type
+     * @param goal_r The goal row
+     * @param goal_c The goal column
+     * @return Flat table with the move count from each square, kUnreachable
+     * where the goal cannot be reached
+     */
+    std::vector<ChessCostType> GenerateDistanceTable(Piece piece, int goal_r,
+                                                     int goal_c) const;
+
+    /**
+     * @brief Generates the move-count table of a pawn that promotes and then
+     * moves to a square as a queen
+     * @param queen_distance Queen distance table toward the goal square
+     * @return Flat table with the move count from each square
+     */
+    std::vector<ChessCostType> GeneratePromotionTable(
+        const std::vector<ChessCostType>& queen_distance) const;
 };
 
 }  // namespace chess_board
 
+/**
+ * @brief Writes chess states as their board followed by their key
+ *
+ * The piece list is rebuilt from the board on reading.
+ */
+template <>
+struct Serializer<chess_board::State> {
+    static void Write(std::ostream& out, const chess_board::State& state) {
+        Serialize(out, state.board);
+        Serialize(out, state.hash);
+    }
+
+    static void Read(std::istream& in, chess_board::State* state) {
+        Deserialize(in, &state->board);
+        Deserialize(in, &state->hash);
+        state->pieces = chess_board::ListPieces(state->board);
+    }
+};
+
 #endif
@@ -0,0 +1,11 @@
+#include "fixed_sliding_tile_problem.h"
+
+namespace sliding_tile {
+
+// Explicit instantiations for the board sizes used in practice, other
+// dimensions are still instantiated implicitly from the .tpp
+template class FixedSlidingTileProblem<3>;
+template class FixedSlidingTileProblem<4>;
+template class FixedSlidingTileProblem<5>;
+
+}  // namespace sliding_tile
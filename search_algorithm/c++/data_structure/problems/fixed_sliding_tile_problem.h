@@ -0,0 +1,291 @@
+/**
+ * @file fixed_sliding_tile_problem.h
+ * @brief Sliding tile puzzle specialized at compile time for a fixed board
+ * dimension
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_FIXED_SLIDING_H_
+#define SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_FIXED_SLIDING_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "problem.h"
+#include "sliding_tile_kernels.h"
+#include "sliding_tile_problem.h"
+#include "static_problem.h"
+
+namespace sliding_tile {
+
+/**
+ * @brief Flat, fixed-size state of an N x N sliding tile puzzle
+ *
+ * Tiles are stored row-major, so the tile at (row, col) lives at index
+ * row * N + col. The value 0 (BLANK_TILE) represents the empty space.
+ *
+ * @tparam N Grid dimension
+ */
+template <std::size_t N>
+using FixedState = std::array<uint8_t, N * N>;
+
+/**
+ * @brief Sliding tile puzzle with the grid dimension fixed at compile time
+ *
+ * Behaves like SlidingTileProblem (same actions, goal layout and costs), but
+ * every loop has a compile-time bound: the goal coordinates, the Manhattan
+ * distance of every tile at every position and the blank tile neighbor table
+ * are constexpr tables, and the per-tile loops are unrolled with fold
+ * expressions. SlidingTileProblem remains the fallback for dimensions that
+ * are only known at runtime.
+ *
+ * @tparam N Grid dimension (3 for 3x3, 4 for 4x4, etc.)
+ *
+ * @note N = 3, 4 and 5 are explicitly instantiated in
+ * fixed_sliding_tile_problem.cc
+ */
+template <std::size_t N>
+class FixedSlidingTileProblem
+    : public StaticProblem<FixedSlidingTileProblem<N>, FixedState<N>, Action,
+                           CostType> {
+    static_assert(N >= 2 && N <= 15,
+                  "FixedSlidingTileProblem supports dimensions 2 to 15");
+
+   public:
+    /// @brief Type alias for the state of this puzzle
+    using StateType = FixedState<N>;
+
+    static constexpr std::size_t kDimension = N;      ///< Grid dimension
+    static constexpr std::size_t kNumTiles = N * N;   ///< Cells in the grid
+    static constexpr uint8_t kNoMove = 0xFF;  ///< Neighbor table sentinel
+
+    /**
+     * @brief Constructs the puzzle from a fixed-size initial state
+     *
+     * @param initial_state The starting configuration
+     * @warning Does not verify if the initial state is solvable
+     */
+    explicit FixedSlidingTileProblem(const StateType& initial_state)
+        : StaticProblem<FixedSlidingTileProblem<N>, StateType, Action,
+                        CostType>(initial_state) {}
+
+    /**
+     * @brief Constructs the puzzle from a runtime-dimension state
+     *
+     * @param initial_state The starting configuration, must be N x N
+     * @throws std::invalid_argument if the state is not N x N or its tiles
+     * are not a permutation of 0 to N^2 - 1
+     */
+    explicit FixedSlidingTileProblem(const State& initial_state)
+        : StaticProblem<FixedSlidingTileProblem<N>, StateType, Action,
+                        CostType>(FromState(initial_state)) {}
+
+    /**
+     * @brief Virtual destructor
+     */
+    virtual ~FixedSlidingTileProblem() = default;
+
+    /**
+     * @brief Tests if a state is the goal state
+     *
+     * @param state The state to test
+     * @return true if the state matches the goal configuration
+     */
+    virtual bool IsGoal(const StateType& state) const override {
+        return state == kGoalState;
+    }
+
+    /**
+     * @brief Gets all valid actions from a given state
+     *
+     * Actions are generated in the same order as SlidingTileProblem, so both
+     * versions explore the search space identically.
+     *
+     * @param state The current state
+     * @return Vector of valid actions (kUp, kDown, kLeft, kRight)
+     */
+    virtual std::vector<Action> GetActions(
+        const StateType& state) const override;
+
+    /**
+     * @brief Applies an action to a state and returns the resulting state
+     *
+     * @param state The current state
+     * @param action The action to apply
+     * @return Unique pointer to new state, or nullptr if action is invalid
+     */
+    virtual std::unique_ptr<StateType> GetResult(
+        const StateType& state, const Action& action) const override;
+
+    /**
+     * @brief Gets the cost of applying an action
+     * @return Always returns 1 (uniform cost)
+     */
+    virtual CostType GetActionCost(const StateType&, const Action&,
+                                   const StateType&) const override {
+        return 1;  // Uniform cost for all actions
+    }
+
+    /**
+     * @brief Calculates the Manhattan distance heuristic for a state
+     *
+     * Sums one table lookup per cell; the blank tile has distance 0 in the
+     * table so it never contributes.
+     *
+     * @param state The state to evaluate
+     * @return Manhattan distance to goal (admissible heuristic)
+     */
+    CostType Heuristic(const StateType& state) const override;
+
+    /**
+     * @brief Maps a state to the representative of its symmetry class
+     *
+     * The goal (blank in the top-left corner, tiles in row-major order) is
+     * symmetric under reflection in the main diagonal, once tiles are
+     * renamed after their reflected goal squares: tile r * n + c becomes
+     * c * n + r. Reflecting a state this way maps moves to moves and the
+     * goal to itself. The representative is the smaller of the state and
+     * its reflection.
+     *
+     * @param state The state to map
+     * @return The state or its reflection
+     */
+    StateType Canonicalize(const StateType& state) const override;
+
+    /**
+     * @brief Evaluates the Manhattan distance of several states in one call
+     *
+     * Called for all the children of an expansion through
+     * ProblemDispatch::HeuristicBatch. The states are copied back to back a
+     * block at a time and the SIMD kernel is dispatched once per block.
+     * Gives the same values as Heuristic.
+     *
+     * @param states The states to evaluate
+     * @param out Output: heuristic value of each state, in the same order
+     */
+    void HeuristicBatch(const std::vector<const StateType*>& states,
+                        std::vector<CostType>* out) const;
+
+    /**
+     * @brief Gets the shared heuristic kernel for this dimension
+     * @return Kernel built once on first use
+     */
+    static const HeuristicKernel& GetHeuristicKernel();
+
+    /**
+     * @brief Finds the flat index of the blank tile
+     *
+     * @param state The state to search
+     * @return Index (row * N + col) of the blank tile, kNumTiles if not found
+     */
+    static std::size_t GetBlankTileIndex(const StateType& state);
+
+    /**
+     * @brief Gets the goal state
+     * @return The target configuration for this puzzle
+     */
+    static constexpr StateType GetGoalState() { return kGoalState; }
+
+    /**
+     * @brief Converts a runtime-dimension state to the fixed-size layout
+     *
+     * @param state N x N state to convert
+     * @return The flattened state
+     * @throws std::invalid_argument if the state is not N x N or its tiles
+     * are not a permutation of 0 to N^2 - 1 (0 being the blank)
+     */
+    static StateType FromState(const State& state);
+
+    /**
+     * @brief Converts a fixed-size state back to the runtime layout
+     *
+     * @param state The flattened state
+     * @return N x N state usable with SlidingTileProblem
+     */
+    static State ToState(const StateType& state);
+
+    /**
+     * @brief Prints a state to console in a readable format
+     * @param state The state to print
+     */
+    void PrintState(const StateType& state) const;
+
+    std::string GetStateString(const StateType& state) const override;
+
+   private:
+    static constexpr StateType MakeGoalState() {
+        StateType goal{};
+        for (std::size_t i = 0; i < kNumTiles; ++i)
+            goal[i] = static_cast<uint8_t>(i);
+        goal[0] = BLANK_TILE;
+        return goal;
+    }
+
+    // Manhattan distance of tile t placed at index p, stored at
+    // [t * kNumTiles + p]. Row 0 (the blank tile) is all zeros.
+    static constexpr std::array<uint8_t, kNumTiles * kNumTiles>
+    MakeManhattanTable() {
+        std::array<uint8_t, kNumTiles * kNumTiles> table{};
+        for (std::size_t tile = 1; tile < kNumTiles; ++tile) {
+            for (std::size_t pos = 0; pos < kNumTiles; ++pos) {
+                std::size_t row = pos / N, col = pos % N;
+                std::size_t goal_row = tile / N, goal_col = tile % N;
+                std::size_t dr = row > goal_row ? row - goal_row
+                                                : goal_row - row;
+                std::size_t dc = col > goal_col ? col - goal_col
+                                                : goal_col - col;
+                table[tile * kNumTiles + pos] = static_cast<uint8_t>(dr + dc);
+            }
+        }
+        return table;
+    }
+
+    // Index the blank tile moves to for each action, stored at
+    // [pos * 4 + action], or kNoMove when the move leaves the grid
+    static constexpr std::array<uint8_t, kNumTiles * 4> MakeNeighborTable() {
+        std::array<uint8_t, kNumTiles * 4> table{};
+        for (std::size_t pos = 0; pos < kNumTiles; ++pos) {
+            std::size_t row = pos / N, col = pos % N;
+            table[pos * 4 + static_cast<std::size_t>(Action::kUp)] =
+                row > 0 ? static_cast<uint8_t>(pos - N) : kNoMove;
+            table[pos * 4 + static_cast<std::size_t>(Action::kDown)] =
+                row < N - 1 ? static_cast<uint8_t>(pos + N) : kNoMove;
+            table[pos * 4 + static_cast<std::size_t>(Action::kLeft)] =
+                col > 0 ? static_cast<uint8_t>(pos - 1) : kNoMove;
+            table[pos * 4 + static_cast<std::size_t>(Action::kRight)] =
+                col < N - 1 ? static_cast<uint8_t>(pos + 1) : kNoMove;
+        }
+        return table;
+    }
+
+    static constexpr StateType kGoalState = MakeGoalState();
+    static constexpr std::array<uint8_t, kNumTiles * kNumTiles>
+        kManhattanTable = MakeManhattanTable();
+    static constexpr std::array<uint8_t, kNumTiles * 4> kNeighborTable =
+        MakeNeighborTable();
+
+    template <std::size_t... I>
+    static CostType SumManhattan(const StateType& state,
+                                 std::index_sequence<I...>);
+
+    template <std::size_t... I>
+    static std::size_t FindBlank(const StateType& state,
+                                 std::index_sequence<I...>);
+};
+
+extern template class FixedSlidingTileProblem<3>;
+extern template class FixedSlidingTileProblem<4>;
+extern template class FixedSlidingTileProblem<5>;
+
+}  // namespace sliding_tile
+
+// Include template implementation
+#include "fixed_sliding_tile_problem.tpp"
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_FIXED_SLIDING_H_
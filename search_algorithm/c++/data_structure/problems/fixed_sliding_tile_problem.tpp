@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "fixed_sliding_tile_problem.h"
+
+namespace sliding_tile {
+
+template <std::size_t N>
+template <std::size_t... I>
+CostType FixedSlidingTileProblem<N>::SumManhattan(const StateType& state,
+                                                  std::index_sequence<I...>) {
+    // One table lookup per cell, unrolled by the fold expression
+    return (static_cast<CostType>(kManhattanTable[state[I] * kNumTiles + I]) +
+            ...);
+}
+
+template <std::size_t N>
+template <std::size_t... I>
+std::size_t FixedSlidingTileProblem<N>::FindBlank(const StateType& state,
+                                                  std::index_sequence<I...>) {
+    std::size_t blank = kNumTiles;
+    // Branchless scan, unrolled by the fold expression
+    ((blank = state[I] == BLANK_TILE ? I : blank), ...);
+    return blank;
+}
+
+template <std::size_t N>
+std::size_t FixedSlidingTileProblem<N>::GetBlankTileIndex(
+    const StateType& state) {
+    return FindBlank(state, std::make_index_sequence<kNumTiles>{});
+}
+
+template <std::size_t N>
+std::vector<Action> FixedSlidingTileProblem<N>::GetActions(
+    const StateType& state) const {
+    std::vector<Action> actions;
+    actions.reserve(4);
+
+    std::size_t blank = GetBlankTileIndex(state);
+
+    // Same order as SlidingTileProblem::GetActions
+    for (Action action :
+         {Action::kUp, Action::kDown, Action::kLeft, Action::kRight})
+        if (kNeighborTable[blank * 4 + static_cast<std::size_t>(action)] !=
+            kNoMove)
+            actions.push_back(action);
+
+    return actions;
+}
+
+template <std::size_t N>
+std::unique_ptr<FixedState<N>> FixedSlidingTileProblem<N>::GetResult(
+    const StateType& state, const Action& action) const {
+    std::size_t blank = GetBlankTileIndex(state);
+    if (blank == kNumTiles) return nullptr;  // No blank tile
+
+    uint8_t target =
+        kNeighborTable[blank * 4 + static_cast<std::size_t>(action)];
+    if (target == kNoMove) return nullptr;  // Invalid move
+
+    auto new_state = std::make_unique<StateType>(state);
+    std::swap((*new_state)[blank], (*new_state)[target]);
+    return new_state;
+}
+
+template <std::size_t N>
+CostType FixedSlidingTileProblem<N>::Heuristic(const StateType& state) const {
+    return SumManhattan(state, std::make_index_sequence<kNumTiles>{});
+}
+
+template <std::size_t N>
+typename FixedSlidingTileProblem<N>::StateType
+FixedSlidingTileProblem<N>::Canonicalize(const StateType& state) const {
+    StateType reflected;
+    for (std::size_t row = 0; row < N; ++row)
+        for (std::size_t col = 0; col < N; ++col) {
+            uint8_t tile = state[col * N + row];
+            reflected[row * N + col] =
+                static_cast<uint8_t>((tile % N) * N + tile / N);
+        }
+
+    return reflected < state ? reflected : state;
+}
+
+template <std::size_t N>
+void FixedSlidingTileProblem<N>::HeuristicBatch(
+    const std::vector<const StateType*>& states,
+    std::vector<CostType>* out) const {
+    static_assert(sizeof(StateType) == kNumTiles,
+                  "States must be stored back to back for the batch kernel");
+    static_assert(std::is_same<CostType, int>::value,
+                  "The batch kernel writes int values");
+
+    // A block covers the children of an expansion without allocating
+    constexpr std::size_t kBlock = 8;
+    StateType block[kBlock];
+    out->resize(states.size());
+    const HeuristicKernel& kernel = GetHeuristicKernel();
+    for (std::size_t first = 0; first < states.size(); first += kBlock) {
+        std::size_t count = std::min(kBlock, states.size() - first);
+        for (std::size_t i = 0; i < count; ++i) block[i] = *states[first + i];
+        kernel.EvaluateBatch(reinterpret_cast<const uint8_t*>(block), count,
+                             false, out->data() + first);
+    }
+}
+
+template <std::size_t N>
+const HeuristicKernel& FixedSlidingTileProblem<N>::GetHeuristicKernel() {
+    static const HeuristicKernel kernel(N);
+    return kernel;
+}
+
+template <std::size_t N>
+FixedState<N> FixedSlidingTileProblem<N>::FromState(const State& state) {
+    if (state.size() != N)
+        throw std::invalid_argument("FromState: state dimension mismatch");
+
+    StateType fixed{};
+    bool seen[kNumTiles] = {};
+    for (std::size_t row = 0; row < N; ++row) {
+        if (state[row].size() != N)
+            throw std::invalid_argument("FromState: state dimension mismatch");
+        for (std::size_t col = 0; col < N; ++col) {
+            uint64_t tile = state[row][col];
+            if (tile >= kNumTiles || seen[tile])
+                throw std::invalid_argument(
+                    "FromState: tiles must hold 0 to N^2 - 1 once each");
+            seen[tile] = true;
+            fixed[row * N + col] = static_cast<uint8_t>(tile);
+        }
+    }
+    return fixed;
+}
+
+template <std::size_t N>
+State FixedSlidingTileProblem<N>::ToState(const StateType& state) {
+    State runtime_state(N, std::vector<uint64_t>(N, 0));
+    for (std::size_t i = 0; i < kNumTiles; ++i)
+        runtime_state[i / N][i % N] = state[i];
+    return runtime_state;
+}
+
+template <std::size_t N>
+void FixedSlidingTileProblem<N>::PrintState(const StateType& state) const {
+    std::cout << GetStateString(state);
+}
+
+template <std::size_t N>
+std::string FixedSlidingTileProblem<N>::GetStateString(
+    const StateType& state) const {
+    std::stringstream state_ss;
+
+    // Width needed to print the largest tile number
+    int width = static_cast<int>(std::to_string(kNumTiles - 1).size());
+
+    for (std::size_t row = 0; row < N; ++row) {
+        for (std::size_t col = 0; col < N; ++col) {
+            state_ss << std::setw(width)
+                     << static_cast<unsigned>(state[row * N + col]);
+            if (col < N - 1) state_ss << " ";
+        }
+        state_ss << std::endl;
+    }
+    return state_ss.str();
+}
+
+}  // namespace sliding_tile
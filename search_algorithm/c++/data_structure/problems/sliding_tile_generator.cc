@@ -0,0 +1,122 @@
+#include "sliding_tile_generator.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+using namespace sliding_tile;
+
+bool sliding_tile::IsSolvable(const State& state) {
+    const std::size_t dimension = state.size();
+    const std::size_t num_squares = dimension * dimension;
+
+    // In the goal, value v sits at square v (blank first), so the board
+    // read row by row is the permutation itself
+    std::vector<uint64_t> permutation;
+    permutation.reserve(num_squares);
+    std::size_t blank_row = 0, blank_col = 0;
+    for (std::size_t r = 0; r < dimension; ++r) {
+        for (std::size_t c = 0; c < dimension; ++c) {
+            if (state[r][c] == BLANK_TILE) blank_row = r, blank_col = c;
+            permutation.push_back(state[r][c]);
+        }
+    }
+
+    // A permutation of n elements with k cycles is n - k transpositions
+    std::vector<bool> visited(num_squares, false);
+    std::size_t cycles = 0;
+    for (std::size_t start = 0; start < num_squares; ++start) {
+        if (visited[start]) continue;
+        ++cycles;
+        for (std::size_t i = start; !visited[i]; i = permutation[i])
+            visited[i] = true;
+    }
+
+    return (num_squares - cycles) % 2 == (blank_row + blank_col) % 2;
+}
+
+InstanceGenerator::InstanceGenerator(uint64_t dimension, uint64_t seed)
+    : dimension_(dimension), rng_(seed) {
+    if (dimension < 2)
+        throw std::invalid_argument(
+            "InstanceGenerator: dimension must be at least 2");
+}
+
+uint64_t InstanceGenerator::Below(uint64_t bound) {
+    // 2^64 mod bound raw values at the bottom would be drawn once too often
+    uint64_t threshold = (0 - bound) % bound;
+    for (;;) {
+        uint64_t value = rng_();
+        if (value >= threshold) return value % bound;
+    }
+}
+
+State InstanceGenerator::RandomSolvable() {
+    const std::size_t num_squares = dimension_ * dimension_;
+    std::vector<uint64_t> tiles(num_squares);
+    std::iota(tiles.begin(), tiles.end(), 0);
+    for (std::size_t i = num_squares - 1; i > 0; --i)
+        std::swap(tiles[i], tiles[Below(i + 1)]);
+
+    State state(dimension_, std::vector<uint64_t>(dimension_));
+    for (std::size_t i = 0; i < num_squares; ++i)
+        state[i / dimension_][i % dimension_] = tiles[i];
+
+    if (!IsSolvable(state)) {
+        // Swapping two tiles flips the permutation parity and leaves the
+        // blank in place, so the board becomes solvable
+        std::size_t first = tiles[0] == BLANK_TILE ? 1 : 0;
+        std::size_t second = tiles[first + 1] == BLANK_TILE ? first + 2
+                                                             : first + 1;
+        std::swap(state[first / dimension_][first % dimension_],
+                  state[second / dimension_][second % dimension_]);
+    }
+    return state;
+}
+
+State InstanceGenerator::RandomWalk(uint64_t num_moves) {
+    State state(dimension_, std::vector<uint64_t>(dimension_));
+    for (uint64_t i = 0; i < dimension_ * dimension_; ++i)
+        state[i / dimension_][i % dimension_] = i;
+
+    // Blank starts in its goal square, the top left corner
+    static const int kRowStep[4] = {-1, 1, 0, 0};
+    static const int kColStep[4] = {0, 0, -1, 1};
+    const int last = static_cast<int>(dimension_) - 1;
+    int row = 0, col = 0;
+    int back = -1;  // Direction undoing the previous move
+
+    for (uint64_t move = 0; move < num_moves; ++move) {
+        int directions[4];
+        int num_directions = 0;
+        for (int d = 0; d < 4; ++d) {
+            int next_row = row + kRowStep[d], next_col = col + kColStep[d];
+            if (d != back && next_row >= 0 && next_row <= last &&
+                next_col >= 0 && next_col <= last)
+                directions[num_directions++] = d;
+        }
+
+        int d = directions[Below(num_directions)];
+        std::swap(state[row][col],
+                  state[row + kRowStep[d]][col + kColStep[d]]);
+        row += kRowStep[d];
+        col += kColStep[d];
+        back = d ^ 1;  // Up and down, left and right are adjacent
+    }
+    return state;
+}
+
+std::vector<State> InstanceGenerator::RandomWalks(std::size_t count,
+                                                  uint64_t min_moves,
+                                                  uint64_t max_moves) {
+    if (max_moves < min_moves)
+        throw std::invalid_argument(
+            "RandomWalks: max_moves must be at least min_moves");
+
+    std::vector<State> states;
+    states.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        states.push_back(
+            RandomWalk(min_moves + Below(max_moves - min_moves + 1)));
+    return states;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file sliding_tile_generator.h
+ * @brief Reproducible sliding tile instance generation
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_TILE_GENERATOR_H_
+#define SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_TILE_GENERATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "sliding_tile_problem.h"
+
+namespace sliding_tile {
+
+/**
+ * @brief Tests if a board can reach the goal layout of SlidingTileProblem
+ *
+ * Every move swaps the blank with a tile and moves the blank one square, so
+ * the parity of the board as a permutation of the goal (blank included)
+ * always equals the parity of the blank's Manhattan distance from its goal
+ * square, the top left corner; the boards with equal parities are exactly
+ * the solvable ones. Holds for every dimension, odd or even. O(n) in the
+ * number of squares, by counting the permutation's cycles.
+ *
+ * @param state The board, holding every value from 0 to dimension^2 - 1 once
+ * @return true if the board is solvable
+ */
+bool IsSolvable(const State& state);
+
+/**
+ * @brief Seeded generator of sliding tile instances
+ *
+ * The same dimension and seed always produce the same sequence of
+ * instances, on every platform (std::mt19937_64 is fully specified and only
+ * its raw output is used).
+ */
+class InstanceGenerator {
+   public:
+    /**
+     * @param dimension Grid size, at least 2
+     * @param seed Seed of the random sequence
+     * @throws std::invalid_argument if dimension is below 2
+     */
+    InstanceGenerator(uint64_t dimension, uint64_t seed);
+
+    /**
+     * @brief Draws a board uniformly from the solvable ones
+     *
+     * Shuffles all squares (Fisher-Yates), then swaps the first two tiles
+     * if the board came out unsolvable. The swap pairs every unsolvable
+     * board with exactly one solvable board, so the result stays uniform
+     * without redrawing. O(n) in the number of squares.
+     *
+     * @return A solvable board
+     */
+    State RandomSolvable();
+
+    /**
+     * @brief Scrambles the goal with a random walk of the blank
+     *
+     * Each step moves the blank to a random neighbouring square other than
+     * the one it just left. The walk length bounds the optimal solution
+     * length from above. Walks also fold back on themselves, so the optimal
+     * lengths of a band of walk lengths spread below it, more so for longer
+     * walks (see instance_generator_benchmark).
+     *
+     * @param num_moves Number of blank moves
+     * @return A solvable board at most num_moves moves from the goal
+     */
+    State RandomWalk(uint64_t num_moves);
+
+    /**
+     * @brief Scrambles the goal with several random walks
+     * @param count Number of boards
+     * @param min_moves Shortest walk length
+     * @param max_moves Longest walk length, at least min_moves
+     * @return count boards, each from a walk of a length drawn uniformly
+     * from [min_moves, max_moves]
+     */
+    std::vector<State> RandomWalks(std::size_t count, uint64_t min_moves,
+                                   uint64_t max_moves);
+
+    /**
+     * @brief Gets the grid size
+     * @return Dimension of generated boards
+     */
+    uint64_t GetDimension() const { return dimension_; }
+
+   private:
+    uint64_t dimension_;
+    std::mt19937_64 rng_;
+
+    /**
+     * @brief Draws an integer uniformly from [0, bound)
+     *
+     * Rejects the few raw outputs that would bias the modulo. Unlike
+     * std::uniform_int_distribution, gives the same values with every
+     * standard library.
+     */
+    uint64_t Below(uint64_t bound);
+};
+
+}  // namespace sliding_tile
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_TILE_GENERATOR_H_
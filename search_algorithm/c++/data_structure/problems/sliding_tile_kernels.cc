@@ -0,0 +1,387 @@
+#include "sliding_tile_kernels.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SLIDING_TILE_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace sliding_tile;
+
+namespace {
+
+#ifdef SLIDING_TILE_KERNELS_X86
+
+// The SIMD kernels are compiled for their own target so the rest of the
+// project keeps the default (baseline x86-64) flags, and only the instruction
+// set chosen at runtime is ever executed.
+
+// Looks up 16 tiles (0..31) in a 32 entry table split in two 16 byte halves.
+// pshufb zeroes lanes whose index has the high bit set, which is used to
+// select the half each tile belongs to.
+__attribute__((target("sse4.1"))) inline __m128i LookupSse41(
+    __m128i table_lo, __m128i table_hi, __m128i tiles) {
+    __m128i high = _mm_cmpgt_epi8(tiles, _mm_set1_epi8(15));
+    __m128i lo = _mm_shuffle_epi8(table_lo, _mm_or_si128(tiles, high));
+    __m128i hi =
+        _mm_shuffle_epi8(table_hi, _mm_sub_epi8(tiles, _mm_set1_epi8(16)));
+    return _mm_or_si128(lo, hi);
+}
+
+__attribute__((target("sse4.1"))) inline __m128i AbsDiffSse41(__m128i a,
+                                                              __m128i b) {
+    return _mm_sub_epi8(_mm_max_epu8(a, b), _mm_min_epu8(a, b));
+}
+
+// Computes the Manhattan distance of a 32 byte padded board and, if digits
+// are requested, the per cell conflict digits
+__attribute__((target("sse4.1"))) int KernelSse41(
+    const uint8_t* padded, std::size_t num_cells, const uint8_t* goal_row,
+    const uint8_t* goal_col, const uint8_t* cell_row, const uint8_t* cell_col,
+    uint8_t none, uint8_t* row_digits, uint8_t* col_digits) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i none_vec = _mm_set1_epi8(static_cast<char>(none));
+    const __m128i row_lo = _mm_loadu_si128((const __m128i*)goal_row);
+    const __m128i row_hi = _mm_loadu_si128((const __m128i*)(goal_row + 16));
+    const __m128i col_lo = _mm_loadu_si128((const __m128i*)goal_col);
+    const __m128i col_hi = _mm_loadu_si128((const __m128i*)(goal_col + 16));
+
+    __m128i sum = zero;
+    for (std::size_t offset = 0; offset < num_cells; offset += 16) {
+        __m128i tiles = _mm_loadu_si128((const __m128i*)(padded + offset));
+        __m128i blank = _mm_cmpeq_epi8(tiles, zero);
+        __m128i tile_row = LookupSse41(row_lo, row_hi, tiles);
+        __m128i tile_col = LookupSse41(col_lo, col_hi, tiles);
+        __m128i row = _mm_loadu_si128((const __m128i*)(cell_row + offset));
+        __m128i col = _mm_loadu_si128((const __m128i*)(cell_col + offset));
+
+        __m128i distance = _mm_add_epi8(AbsDiffSse41(tile_row, row),
+                                        AbsDiffSse41(tile_col, col));
+        distance = _mm_andnot_si128(blank, distance);
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(distance, zero));
+
+        if (row_digits) {
+            __m128i in_row =
+                _mm_andnot_si128(blank, _mm_cmpeq_epi8(tile_row, row));
+            __m128i in_col =
+                _mm_andnot_si128(blank, _mm_cmpeq_epi8(tile_col, col));
+            _mm_storeu_si128((__m128i*)(row_digits + offset),
+                             _mm_blendv_epi8(none_vec, tile_col, in_row));
+            _mm_storeu_si128((__m128i*)(col_digits + offset),
+                             _mm_blendv_epi8(none_vec, tile_row, in_col));
+        }
+    }
+
+    return _mm_cvtsi128_si32(sum) + _mm_extract_epi32(sum, 2);
+}
+
+__attribute__((target("avx2"))) inline __m256i LookupAvx2(__m256i table_lo,
+                                                          __m256i table_hi,
+                                                          __m256i tiles) {
+    __m256i high = _mm256_cmpgt_epi8(tiles, _mm256_set1_epi8(15));
+    __m256i lo = _mm256_shuffle_epi8(table_lo, _mm256_or_si256(tiles, high));
+    __m256i hi = _mm256_shuffle_epi8(
+        table_hi, _mm256_sub_epi8(tiles, _mm256_set1_epi8(16)));
+    return _mm256_or_si256(lo, hi);
+}
+
+__attribute__((target("avx2"))) inline __m256i AbsDiffAvx2(__m256i a,
+                                                           __m256i b) {
+    return _mm256_sub_epi8(_mm256_max_epu8(a, b), _mm256_min_epu8(a, b));
+}
+
+// Same as KernelSse41, but the whole padded board fits one register. The
+// shuffles work per 128-bit lane, so each table half is broadcast to both.
+__attribute__((target("avx2"))) int KernelAvx2(
+    const uint8_t* padded, const uint8_t* goal_row, const uint8_t* goal_col,
+    const uint8_t* cell_row, const uint8_t* cell_col, uint8_t none,
+    uint8_t* row_digits, uint8_t* col_digits) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i row_lo = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)goal_row));
+    const __m256i row_hi = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)(goal_row + 16)));
+    const __m256i col_lo = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)goal_col));
+    const __m256i col_hi = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)(goal_col + 16)));
+
+    __m256i tiles = _mm256_loadu_si256((const __m256i*)padded);
+    __m256i blank = _mm256_cmpeq_epi8(tiles, zero);
+    __m256i tile_row = LookupAvx2(row_lo, row_hi, tiles);
+    __m256i tile_col = LookupAvx2(col_lo, col_hi, tiles);
+    __m256i row = _mm256_loadu_si256((const __m256i*)cell_row);
+    __m256i col = _mm256_loadu_si256((const __m256i*)cell_col);
+
+    __m256i distance = _mm256_add_epi8(AbsDiffAvx2(tile_row, row),
+                                       AbsDiffAvx2(tile_col, col));
+    distance = _mm256_andnot_si256(blank, distance);
+    __m256i sum = _mm256_sad_epu8(distance, zero);
+
+    if (row_digits) {
+        const __m256i none_vec = _mm256_set1_epi8(static_cast<char>(none));
+        __m256i in_row =
+            _mm256_andnot_si256(blank, _mm256_cmpeq_epi8(tile_row, row));
+        __m256i in_col =
+            _mm256_andnot_si256(blank, _mm256_cmpeq_epi8(tile_col, col));
+        _mm256_storeu_si256((__m256i*)row_digits,
+                            _mm256_blendv_epi8(none_vec, tile_col, in_row));
+        _mm256_storeu_si256((__m256i*)col_digits,
+                            _mm256_blendv_epi8(none_vec, tile_row, in_col));
+    }
+
+    return _mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 2) +
+           _mm256_extract_epi32(sum, 4) + _mm256_extract_epi32(sum, 6);
+}
+
+#endif  // SLIDING_TILE_KERNELS_X86
+
+}  // namespace
+
+KernelIsa sliding_tile::DetectKernelIsa() {
+#ifdef SLIDING_TILE_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return KernelIsa::kAvx2;
+    if (__builtin_cpu_supports("sse4.1")) return KernelIsa::kSse41;
+#endif
+    return KernelIsa::kScalar;
+}
+
+const char* sliding_tile::KernelIsaName(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::kAvx2:
+            return "avx2";
+        case KernelIsa::kSse41:
+            return "sse4.1";
+        default:
+            return "scalar";
+    }
+}
+
+HeuristicKernel::HeuristicKernel(std::size_t dimension, KernelIsa isa)
+    : dimension_(dimension), num_cells_(dimension * dimension), isa_(isa) {
+    if (dimension_ == 0 || dimension_ > kMaxDimension)
+        throw std::invalid_argument(
+            "HeuristicKernel: dimension must be between 1 and 15");
+
+    // Never use an instruction set the CPU lacks or the board does not fit
+    KernelIsa supported = DetectKernelIsa();
+    if (static_cast<int>(isa_) > static_cast<int>(supported)) isa_ = supported;
+    if (dimension_ > kMaxSimdDimension) isa_ = KernelIsa::kScalar;
+
+    goal_row_table_.resize(num_cells_);
+    goal_col_table_.resize(num_cells_);
+    for (std::size_t tile = 0; tile < num_cells_; ++tile) {
+        // Goal places tile t at index t
+        goal_row_table_[tile] = static_cast<uint8_t>(tile / dimension_);
+        goal_col_table_[tile] = static_cast<uint8_t>(tile % dimension_);
+    }
+
+    if (num_cells_ <= kLanes) {
+        for (std::size_t i = 0; i < num_cells_; ++i) {
+            goal_row_[i] = goal_row_table_[i];
+            goal_col_[i] = goal_col_table_[i];
+            cell_row_[i] = goal_row_table_[i];
+            cell_col_[i] = goal_col_table_[i];
+        }
+    }
+
+    manhattan_table_.assign(num_cells_ * num_cells_, 0);
+    for (std::size_t tile = 1; tile < num_cells_; ++tile) {
+        for (std::size_t cell = 0; cell < num_cells_; ++cell) {
+            int dr = static_cast<int>(goal_row_table_[cell]) -
+                     static_cast<int>(goal_row_table_[tile]);
+            int dc = static_cast<int>(goal_col_table_[cell]) -
+                     static_cast<int>(goal_col_table_[tile]);
+            manhattan_table_[tile * num_cells_ + cell] =
+                static_cast<uint8_t>(std::abs(dr) + std::abs(dc));
+        }
+    }
+
+    if (dimension_ <= kMaxConflictTableDimension) {
+        // One entry per combination of kDigitBits wide digits; combinations
+        // with digits that cannot occur are left at 0 and never looked up
+        conflict_table_.assign(std::size_t{1} << (kDigitBits * dimension_), 0);
+        uint8_t digits[kMaxConflictTableDimension];
+        for (std::size_t key = 0; key < conflict_table_.size(); ++key) {
+            for (std::size_t i = 0; i < dimension_; ++i)
+                digits[i] = (key >> (kDigitBits * i)) & ((1 << kDigitBits) - 1);
+            conflict_table_[key] = LinePenalty(digits, dimension_, kNone);
+        }
+    }
+}
+
+uint8_t HeuristicKernel::LinePenalty(const uint8_t* digits, std::size_t count,
+                                     uint8_t none) {
+    // Longest strictly increasing subsequence of the goal positions: those
+    // tiles can stay, every other tile of the line has to step out and back
+    uint8_t tails[kMaxDimension];
+    std::size_t length = 0, present = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (digits[i] == none) continue;
+        ++present;
+        uint8_t* slot = std::lower_bound(tails, tails + length, digits[i]);
+        *slot = digits[i];
+        if (slot == tails + length) ++length;
+    }
+    return static_cast<uint8_t>(2 * (present - length));
+}
+
+int HeuristicKernel::SumConflicts(const uint8_t* row_digits,
+                                  const uint8_t* col_digits) const {
+    int total = 0;
+    for (std::size_t line = 0; line < dimension_; ++line) {
+        std::size_t row_key = 0, col_key = 0;
+        for (std::size_t i = 0; i < dimension_; ++i) {
+            row_key |= std::size_t{row_digits[line * dimension_ + i]}
+                       << (kDigitBits * i);
+            col_key |= std::size_t{col_digits[i * dimension_ + line]}
+                       << (kDigitBits * i);
+        }
+        total += conflict_table_[row_key] + conflict_table_[col_key];
+    }
+    return total;
+}
+
+int HeuristicKernel::ManhattanScalar(const uint8_t* board) const {
+    int total = 0;
+    for (std::size_t cell = 0; cell < num_cells_; ++cell)
+        total += manhattan_table_[board[cell] * num_cells_ + cell];
+    return total;
+}
+
+int HeuristicKernel::ConflictsScalar(const uint8_t* board) const {
+    const bool use_table = !conflict_table_.empty();
+    const uint8_t none = use_table ? kNone : 0xFF;
+
+    uint8_t row_digits[kMaxDimension * kMaxDimension];
+    uint8_t col_digits[kMaxDimension * kMaxDimension];
+    for (std::size_t cell = 0; cell < num_cells_; ++cell) {
+        uint8_t tile = board[cell];
+        bool blank = tile == 0;
+        row_digits[cell] =
+            !blank && goal_row_table_[tile] == goal_row_table_[cell]
+                ? goal_col_table_[tile]
+                : none;
+        col_digits[cell] =
+            !blank && goal_col_table_[tile] == goal_col_table_[cell]
+                ? goal_row_table_[tile]
+                : none;
+    }
+
+    if (use_table) return SumConflicts(row_digits, col_digits);
+
+    // Boards too large for the table compute every line directly
+    int total = 0;
+    uint8_t line_digits[kMaxDimension];
+    for (std::size_t line = 0; line < dimension_; ++line) {
+        total += LinePenalty(row_digits + line * dimension_, dimension_, none);
+        for (std::size_t i = 0; i < dimension_; ++i)
+            line_digits[i] = col_digits[i * dimension_ + line];
+        total += LinePenalty(line_digits, dimension_, none);
+    }
+    return total;
+}
+
+int HeuristicKernel::EvaluateSse41(const uint8_t* board, bool with_manhattan,
+                                   bool with_conflicts) const {
+#ifdef SLIDING_TILE_KERNELS_X86
+    uint8_t padded[kLanes] = {0};
+    uint8_t row_digits[kLanes], col_digits[kLanes];
+    std::memcpy(padded, board, num_cells_);
+
+    int manhattan = KernelSse41(
+        padded, num_cells_, goal_row_.data(), goal_col_.data(),
+        cell_row_.data(), cell_col_.data(), kNone,
+        with_conflicts ? row_digits : nullptr, col_digits);
+
+    int total = with_manhattan ? manhattan : 0;
+    if (with_conflicts) total += SumConflicts(row_digits, col_digits);
+    return total;
+#else
+    return (with_manhattan ? ManhattanScalar(board) : 0) +
+           (with_conflicts ? ConflictsScalar(board) : 0);
+#endif
+}
+
+int HeuristicKernel::EvaluateAvx2(const uint8_t* board, bool with_manhattan,
+                                  bool with_conflicts) const {
+#ifdef SLIDING_TILE_KERNELS_X86
+    uint8_t padded[kLanes] = {0};
+    uint8_t row_digits[kLanes], col_digits[kLanes];
+    std::memcpy(padded, board, num_cells_);
+
+    int manhattan = KernelAvx2(padded, goal_row_.data(), goal_col_.data(),
+                               cell_row_.data(), cell_col_.data(), kNone,
+                               with_conflicts ? row_digits : nullptr,
+                               col_digits);
+
+    int total = with_manhattan ? manhattan : 0;
+    if (with_conflicts) total += SumConflicts(row_digits, col_digits);
+    return total;
+#else
+    return (with_manhattan ? ManhattanScalar(board) : 0) +
+           (with_conflicts ? ConflictsScalar(board) : 0);
+#endif
+}
+
+int HeuristicKernel::Manhattan(const uint8_t* board) const {
+    switch (isa_) {
+        case KernelIsa::kAvx2:
+            return EvaluateAvx2(board, true, false);
+        case KernelIsa::kSse41:
+            return EvaluateSse41(board, true, false);
+        default:
+            return ManhattanScalar(board);
+    }
+}
+
+int HeuristicKernel::Conflicts(const uint8_t* board) const {
+    switch (isa_) {
+        case KernelIsa::kAvx2:
+            return EvaluateAvx2(board, false, true);
+        case KernelIsa::kSse41:
+            return EvaluateSse41(board, false, true);
+        default:
+            return ConflictsScalar(board);
+    }
+}
+
+int HeuristicKernel::ManhattanConflicts(const uint8_t* board) const {
+    switch (isa_) {
+        case KernelIsa::kAvx2:
+            return EvaluateAvx2(board, true, true);
+        case KernelIsa::kSse41:
+            return EvaluateSse41(board, true, true);
+        default:
+            return ManhattanScalar(board) + ConflictsScalar(board);
+    }
+}
+
+void HeuristicKernel::EvaluateBatch(const uint8_t* boards, std::size_t count,
+                                    bool with_conflicts, int* out) const {
+    // Dispatch once for the whole batch
+    switch (isa_) {
+        case KernelIsa::kAvx2:
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = EvaluateAvx2(boards + i * num_cells_, true,
+                                      with_conflicts);
+            break;
+        case KernelIsa::kSse41:
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = EvaluateSse41(boards + i * num_cells_, true,
+                                       with_conflicts);
+            break;
+        default:
+            for (std::size_t i = 0; i < count; ++i) {
+                const uint8_t* board = boards + i * num_cells_;
+                out[i] = ManhattanScalar(board) +
+                         (with_conflicts ? ConflictsScalar(board) : 0);
+            }
+            break;
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * @file sliding_tile_kernels.h
+ * @brief Table-driven and SIMD heuristic kernels for the sliding tile puzzle
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_KERNELS_H_
+#define SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_KERNELS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sliding_tile {
+
+/**
+ * @brief Instruction set used by a HeuristicKernel
+ */
+enum class KernelIsa {
+    kScalar,  ///< Portable table lookups, one tile at a time
+    kSse41,   ///< 16 tiles per instruction (SSSE3 shuffles + SSE4.1 blends)
+    kAvx2     ///< A whole board of up to 32 cells per instruction
+};
+
+/**
+ * @brief Detects the best instruction set supported by the running CPU
+ * @return kAvx2, kSse41 or kScalar
+ */
+KernelIsa DetectKernelIsa();
+
+/**
+ * @brief Gets a printable name for an instruction set
+ * @param isa The instruction set
+ * @return "scalar", "sse4.1" or "avx2"
+ */
+const char* KernelIsaName(KernelIsa isa);
+
+/**
+ * @brief Manhattan distance and linear conflict kernels over flat boards
+ *
+ * Boards are passed as row-major arrays of N * N bytes, where the value 0 is
+ * the blank tile and the goal places tile t at index t (blank first), the
+ * same layout used by SlidingTileProblem and FixedSlidingTileProblem.
+ *
+ * Goal rows and columns come from lookup tables instead of division and
+ * modulo. On SSE4.1 and AVX2 the lookups are done with byte shuffles over the
+ * whole board at once. Linear conflicts are looked up per row and column in a
+ * table indexed by the goal positions of the tiles that belong to that line.
+ *
+ * The instruction set is chosen at construction (by default the best one the
+ * CPU supports); boards larger than kMaxSimdDimension always use the scalar
+ * path.
+ */
+class HeuristicKernel {
+   public:
+    static constexpr std::size_t kMaxDimension = 15;  ///< Tiles fit in a byte
+    static constexpr std::size_t kMaxSimdDimension = 5;  ///< 25 of 32 lanes
+    static constexpr std::size_t kMaxConflictTableDimension = 6;
+
+    /**
+     * @brief Builds the lookup tables for a board dimension
+     *
+     * @param dimension Grid size (3 for 3x3, 4 for 4x4, etc.)
+     * @param isa Instruction set to use, downgraded if the CPU or the
+     * dimension does not support it
+     * @throws std::invalid_argument if dimension is 0 or above kMaxDimension
+     */
+    explicit HeuristicKernel(std::size_t dimension,
+                             KernelIsa isa = DetectKernelIsa());
+
+    /**
+     * @brief Gets the grid dimension the tables were built for
+     * @return The dimension
+     */
+    std::size_t GetDimension() const { return dimension_; }
+
+    /**
+     * @brief Gets the instruction set actually used
+     * @return The instruction set
+     */
+    KernelIsa GetIsa() const { return isa_; }
+
+    /**
+     * @brief Sum of the Manhattan distances of all non-blank tiles
+     * @param board Row-major board of N * N bytes
+     * @return Manhattan distance to the goal
+     */
+    int Manhattan(const uint8_t* board) const;
+
+    /**
+     * @brief Extra moves required by row and column conflicts
+     *
+     * For every row (column), counts the minimum number of tiles that must
+     * leave the line so the remaining tiles whose goal is in that line are in
+     * goal order; each such tile costs two extra moves. Adding this value to
+     * the Manhattan distance keeps the heuristic admissible.
+     *
+     * @param board Row-major board of N * N bytes
+     * @return Linear conflict penalty (always even)
+     */
+    int Conflicts(const uint8_t* board) const;
+
+    /**
+     * @brief Manhattan distance plus linear conflicts in a single pass
+     * @param board Row-major board of N * N bytes
+     * @return Manhattan(board) + Conflicts(board)
+     */
+    int ManhattanConflicts(const uint8_t* board) const;
+
+    /**
+     * @brief Evaluates several boards in one call
+     *
+     * Intended for all the children of an expansion: the instruction set is
+     * dispatched and the tables are loaded once for the whole batch.
+     *
+     * @param boards count boards of N * N bytes stored back to back
+     * @param count Number of boards
+     * @param with_conflicts If true, adds the linear conflict penalty
+     * @param out Output array of count values
+     */
+    void EvaluateBatch(const uint8_t* boards, std::size_t count,
+                       bool with_conflicts, int* out) const;
+
+   private:
+    static constexpr std::size_t kLanes = 32;  ///< Padded board size for SIMD
+    static constexpr uint8_t kNone = 7;  ///< Conflict digit of foreign tiles
+    static constexpr int kDigitBits = 3;  ///< Bits per conflict table digit
+
+    std::size_t dimension_;
+    std::size_t num_cells_;
+    KernelIsa isa_;
+
+    // Tile -> goal row / goal column, padded to 32 entries for shuffles
+    std::array<uint8_t, kLanes> goal_row_{};
+    std::array<uint8_t, kLanes> goal_col_{};
+    // Cell index -> row / column, padded to 32 lanes
+    std::array<uint8_t, kLanes> cell_row_{};
+    std::array<uint8_t, kLanes> cell_col_{};
+
+    std::vector<uint8_t> manhattan_table_;  ///< [tile * cells + cell]
+    std::vector<uint8_t> goal_row_table_;   ///< Tile -> goal row, any size
+    std::vector<uint8_t> goal_col_table_;   ///< Tile -> goal column, any size
+    /// Line penalty indexed by the packed goal positions of a row or column
+    std::vector<uint8_t> conflict_table_;
+
+    /**
+     * @brief Computes the line penalty of a sequence of goal positions
+     * @param digits Goal position of each tile in line order, none for tiles
+     * that belong to another line
+     * @param count Number of digits
+     * @param none Value marking tiles that belong to another line
+     * @return Twice the number of tiles to remove to leave the line in order
+     */
+    static uint8_t LinePenalty(const uint8_t* digits, std::size_t count,
+                               uint8_t none);
+
+    /**
+     * @brief Sums the conflict table over rows and columns
+     * @param row_digits Per cell goal column of tiles in their goal row
+     * @param col_digits Per cell goal row of tiles in their goal column
+     * @return Linear conflict penalty of the board
+     */
+    int SumConflicts(const uint8_t* row_digits,
+                     const uint8_t* col_digits) const;
+
+    int ManhattanScalar(const uint8_t* board) const;
+    int ConflictsScalar(const uint8_t* board) const;
+
+    int EvaluateSse41(const uint8_t* board, bool with_manhattan,
+                      bool with_conflicts) const;
+    int EvaluateAvx2(const uint8_t* board, bool with_manhattan,
+                     bool with_conflicts) const;
+};
+
+}  // namespace sliding_tile
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_KERNELS_H_
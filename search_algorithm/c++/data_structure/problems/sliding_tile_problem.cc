@@ -1,69 +1,22 @@
 #include "sliding_tile_problem.h"
 
-#include <cstdlib>
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
-#include <numeric>
+#include <random>
 #include <stdexcept>
 
+#include "sliding_tile_generator.h"
+
 using namespace sliding_tile;
 
 bool SlidingTileProblem::IsSolvable(State const& state) const {
-    std::vector<uint64_t> flat_state;
-    for (const auto& row : state) {
-        for (const auto& tile : row) {
-            if (tile != BLANK_TILE)  // Exclude blank tile
-                flat_state.push_back(tile);
-        }
-    }
-
-    uint64_t inversions = 0;
-    for (uint64_t i = 0; i < flat_state.size(); ++i) {
-        uint64_t num = flat_state[i];
-        for (uint64_t j = i + 1; j < flat_state.size(); ++j)
-            if (flat_state[j] < num) inversions++;
-    }
-
-    bool even_board = (dimension_ % 2 == 0);
-    bool even_inversions = (inversions % 2 == 0);
-
-    if (even_board)
-        throw std::logic_error(
-            "IsSolvable: Even dimension case not implemented");
-
-    // If inversions is even and dimension is odd -> solvable
-    if (even_inversions)
-        return true;
-    else
-        return false;
+    return sliding_tile::IsSolvable(state);
 }
 
 State SlidingTileProblem::RandomizeBoard() {
-    srand(time(NULL));
-
-    State state = State(dimension_, std::vector<uint64_t>(dimension_, 0));
-
-    uint64_t num_tiles = dimension_ * dimension_;
-
-    // Fill vector with tile numbers 0 to num_tiles-1
-    std::vector<uint64_t> tiles(num_tiles);
-    std::iota(tiles.begin(), tiles.end(), 0);
-
-    do {
-        std::vector<uint64_t> tiles_copy = tiles;
-        // Attribute random values to each tile
-        for (uint64_t i = 0; i < num_tiles; ++i) {
-            int row = i / dimension_;
-            int col = i % dimension_;
-
-            // Get random index from remaining tiles
-            int rand_index = rand() % (num_tiles - i);
-            state[row][col] = tiles_copy[rand_index];
-            tiles_copy.erase(tiles_copy.begin() + rand_index);
-        }
-    } while (!IsSolvable(state));
-
-    return state;
+    return InstanceGenerator(dimension_, std::random_device{}())
+        .RandomSolvable();
 }
 
 std::unique_ptr<State> SlidingTileProblem::GetResult(
@@ -138,30 +91,34 @@ std::vector<Action> SlidingTileProblem::GetActions(const State& state) const {
 }
 
 CostType SlidingTileProblem::Heuristic(const State& state) const {
+    if (heuristic_kernel_) {
+        // Flatten the board for the table-driven kernels
+        uint8_t board[HeuristicKernel::kMaxDimension *
+                      HeuristicKernel::kMaxDimension];
+        for (uint64_t row = 0; row < dimension_; ++row)
+            for (uint64_t col = 0; col < dimension_; ++col)
+                board[row * dimension_ + col] =
+                    static_cast<uint8_t>(state[row][col]);
+
+        // Linear conflict already includes (and dominates) Manhattan
+        CostType h = 0;
+        if (HasHeuristic(heuristics_, HeuristicType::kLinearConflict))
+            h = heuristic_kernel_->ManhattanConflicts(board);
+        else if (HasHeuristic(heuristics_, HeuristicType::kManhattan))
+            h = heuristic_kernel_->Manhattan(board);
+        if (walking_distance_)
+            h = std::max(h, walking_distance_->Lookup(board));
+        return h;
+    }
+
     // Using Manhattan distance as heuristic
     int total_distance = 0;
 
-    // Find blank tile position
-    int blank_row, blank_col;
-    std::tie(blank_row, blank_col) = GetBlankTileIndex(state);
-
-    for (uint64_t row = 0; row <= blank_row; ++row) {
-        for (uint64_t col = 0; col < blank_col; ++col) {
+    for (uint64_t row = 0; row < dimension_; ++row) {
+        for (uint64_t col = 0; col < dimension_; ++col) {
             uint64_t tile = state[row][col];
-            // Calculate goal position
-            uint64_t goal_row = tile / dimension_;
-            uint64_t goal_col = tile % dimension_;
+            if (tile == BLANK_TILE) continue;  // Blank does not count
 
-            // Calculate Manhattan distance
-            total_distance +=
-                std::abs(static_cast<int>(row) - static_cast<int>(goal_row)) +
-                std::abs(static_cast<int>(col) - static_cast<int>(goal_col));
-        }
-    }
-
-    for (uint64_t row = blank_row; row < dimension_; ++row) {
-        for (uint64_t col = blank_col + 1; col < dimension_; ++col) {
-            uint64_t tile = state[row][col];
             // Calculate goal position
             uint64_t goal_row = tile / dimension_;
             uint64_t goal_col = tile % dimension_;
@@ -176,6 +133,27 @@ CostType SlidingTileProblem::Heuristic(const State& state) const {
     return total_distance;
 }
 
+std::shared_ptr<const HeuristicKernel>
+SlidingTileProblem::CreateHeuristicKernel() const {
+    if (dimension_ == 0 || dimension_ > HeuristicKernel::kMaxDimension)
+        return nullptr;
+    return std::make_shared<const HeuristicKernel>(dimension_);
+}
+
+std::shared_ptr<const WalkingDistanceTable>
+SlidingTileProblem::LoadWalkingDistance() const {
+    if (!heuristic_kernel_ &&
+        (HasHeuristic(heuristics_, HeuristicType::kLinearConflict) ||
+         HasHeuristic(heuristics_, HeuristicType::kWalkingDistance)))
+        throw std::invalid_argument(
+            "SlidingTileProblem: only Manhattan is available for this "
+            "dimension");
+
+    if (!HasHeuristic(heuristics_, HeuristicType::kWalkingDistance))
+        return nullptr;
+    return WalkingDistanceTable::Get(dimension_);
+}
+
 // Return blank tile position as (row, col)
 std::pair<int, int> SlidingTileProblem::GetBlankTileIndex(
     const State& state) const {
@@ -220,6 +198,32 @@ void SlidingTileProblem::PrintState(const State& state) const {
     }
 }
 
+State SlidingTileProblem::Canonicalize(const State& state) const {
+    auto reflect = [&](uint64_t row, uint64_t col) {
+        uint64_t tile = state[col][row];
+        return (tile % dimension_) * dimension_ + tile / dimension_;
+    };
+
+    // Compare with the reflection cell by cell first, it is only built when
+    // it is the smaller one
+    bool reflection_smaller = false;
+    for (uint64_t cell = 0; cell < dimension_ * dimension_; ++cell) {
+        uint64_t row = cell / dimension_, col = cell % dimension_;
+        uint64_t reflected = reflect(row, col);
+        if (reflected != state[row][col]) {
+            reflection_smaller = reflected < state[row][col];
+            break;
+        }
+    }
+    if (!reflection_smaller) return state;
+
+    State reflected(dimension_, std::vector<uint64_t>(dimension_));
+    for (uint64_t row = 0; row < dimension_; ++row)
+        for (uint64_t col = 0; col < dimension_; ++col)
+            reflected[row][col] = reflect(row, col);
+    return reflected;
+}
+
 std::string SlidingTileProblem::GetStateString(const State& state) const {
     std::stringstream state_ss;
 
@@ -9,10 +9,14 @@
 #ifndef SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_H_
 #define SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_SLIDING_H_
 
+#include <memory>
 #include <vector>
 
 #include "node.h"
 #include "problem.h"
+#include "sliding_tile_kernels.h"
+#include "static_problem.h"
+#include "walking_distance.h"
 
 #define BLANK_TILE 0  ///< Value representing the blank tile in the puzzle
 
@@ -50,6 +54,33 @@ using State = std::vector<std::vector<uint64_t>>;
 
 using CostType = int;  ///< Cost type for actions (uniform cost of 1)
 
+/**
+ * @brief Admissible heuristics available for the sliding tile puzzle
+ *
+ * Values are bit flags: combine them with operator| and the problem uses the
+ * maximum of the selected heuristics, which is still admissible.
+ */
+enum class HeuristicType : uint8_t {
+    kManhattan = 1 << 0,       ///< Sum of tile Manhattan distances
+    kLinearConflict = 1 << 1,  ///< Manhattan plus row/column conflicts
+    kWalkingDistance = 1 << 2  ///< Table based walking distance (up to 4x4)
+};
+
+/**
+ * @brief Combines heuristics so the problem takes their maximum
+ */
+inline HeuristicType operator|(HeuristicType lhs, HeuristicType rhs) {
+    return static_cast<HeuristicType>(static_cast<uint8_t>(lhs) |
+                                      static_cast<uint8_t>(rhs));
+}
+
+/**
+ * @brief Tests if a heuristic is part of a combination
+ */
+inline bool HasHeuristic(HeuristicType set, HeuristicType heuristic) {
+    return (static_cast<uint8_t>(set) & static_cast<uint8_t>(heuristic)) != 0;
+}
+
 /**
  * @brief Sliding tile puzzle problem implementation
  *
@@ -61,32 +92,37 @@ using CostType = int;  ///< Cost type for actions (uniform cost of 1)
  * space. The goal is to arrange tiles in ascending order with the blank
  * in the bottom-right corner.
  *
- * @note The class ensures generated puzzles are solvable by checking
- *       the inversion count and blank tile position parity.
+ * @note The class ensures generated puzzles are solvable by matching
+ *       the permutation parity with the blank tile position parity.
  */
-class SlidingTileProblem : public Problem<State, Action, CostType> {
+class SlidingTileProblem
+    : public StaticProblem<SlidingTileProblem, State, Action, CostType> {
    private:
     uint64_t dimension_ = 3;  ///< Grid dimension (3 for 3x3, 4 for 4x4, etc.)
     State goal_state_;        ///< Target configuration to reach
+    HeuristicType heuristics_ =
+        HeuristicType::kManhattan;  ///< Heuristics combined by max
+    std::shared_ptr<const HeuristicKernel>
+        heuristic_kernel_;  ///< Lookup tables, nullptr if dimension too large
+    std::shared_ptr<const WalkingDistanceTable>
+        walking_distance_;  ///< Only set if kWalkingDistance is selected
 
     /**
      * @brief Generates a random solvable puzzle configuration
      *
-     * Creates a randomized initial state that is guaranteed to be solvable.
-     * Uses the inversion count rule to ensure solvability.
+     * Draws uniformly from the solvable boards with an InstanceGenerator
+     * seeded from std::random_device; use InstanceGenerator directly for
+     * reproducible boards.
      *
      * @return Random solvable state
-     * @note Only generates valid, solvable configurations
      */
     State RandomizeBoard();
 
     /**
      * @brief Checks if a given state is solvable
      *
-     * Determines puzzle solvability using the inversion count rule:
-     * - For odd grid width: puzzle is solvable if inversion count is even
-     * - For even grid width (NOT IMPLEMENTED): depends on blank position and
-     * inversion count
+     * Compares the permutation parity with the blank's distance from its
+     * goal square (see sliding_tile::IsSolvable), for any grid width.
      *
      * @param state The state to check for solvability
      * @return true if the state is solvable, false otherwise
@@ -103,33 +139,60 @@ class SlidingTileProblem : public Problem<State, Action, CostType> {
      */
     State GenerateGoalState() const;
 
+    /**
+     * @brief Creates the heuristic kernel for the current dimension
+     * @return The kernel, or nullptr if the tiles do not fit in a byte
+     */
+    std::shared_ptr<const HeuristicKernel> CreateHeuristicKernel() const;
+
+    /**
+     * @brief Gets the walking distance table if it was selected
+     * @return The shared table, or nullptr if kWalkingDistance is not used
+     * @throws std::invalid_argument if the heuristics need tables that are
+     * not available for the current dimension
+     */
+    std::shared_ptr<const WalkingDistanceTable> LoadWalkingDistance() const;
+
    public:
     /**
      * @brief Constructs puzzle with specified initial state and dimension
      *
      * @param initial_state The starting configuration
      * @param dimension Grid size (3 for 3x3, 4 for 4x4, etc.)
+     * @param heuristics Heuristics to combine by max (default: Manhattan)
      * @warning Does not verify if the initial state is solvable
+     * @throws std::invalid_argument if a selected heuristic does not support
+     * the dimension
      */
-    SlidingTileProblem(const State& initial_state, const uint64_t dimension)
-        : Problem<State, Action, CostType>(initial_state),
+    SlidingTileProblem(const State& initial_state, const uint64_t dimension,
+                       HeuristicType heuristics = HeuristicType::kManhattan)
+        : StaticProblem<SlidingTileProblem, State, Action, CostType>(
+              initial_state),
           dimension_(dimension),
-          goal_state_(GenerateGoalState()) {}
+          goal_state_(GenerateGoalState()),
+          heuristics_(heuristics),
+          heuristic_kernel_(CreateHeuristicKernel()),
+          walking_distance_(LoadWalkingDistance()) {}
 
     /**
      * @brief Constructs puzzle with random solvable initial state
      *
      * @param dimension Grid size (3 for 3x3, 4 for 4x4, etc.)
+     * @param heuristics Heuristics to combine by max (default: Manhattan)
      * @note Automatically generates a solvable random initial configuration
      * @note We need to call the base class constructor first, that's why
      * the initial state is passed as a dummy state and then the dimension is
      * set and the initial state is overwritten with a random board.
      */
-    SlidingTileProblem(const uint64_t dimension)
-        : Problem<State, Action, CostType>(
+    SlidingTileProblem(const uint64_t dimension,
+                       HeuristicType heuristics = HeuristicType::kManhattan)
+        : StaticProblem<SlidingTileProblem, State, Action, CostType>(
               State(dimension, std::vector<uint64_t>(dimension, 0))),
           dimension_(dimension),
-          goal_state_(GenerateGoalState()) {
+          goal_state_(GenerateGoalState()),
+          heuristics_(heuristics),
+          heuristic_kernel_(CreateHeuristicKernel()),
+          walking_distance_(LoadWalkingDistance()) {
         this->initial_state_ = RandomizeBoard();
     }
 
@@ -190,21 +253,50 @@ class SlidingTileProblem : public Problem<State, Action, CostType> {
     /**
      * @brief Calculates heuristic value for a state
      *
-     * Computes the Manhattan distance heuristic, which is the sum of
-     * distances each tile must move to reach its goal position.
-     * This heuristic is admissible for A* search.
+     * Returns the maximum of the heuristics selected at construction:
+     * - kManhattan: sum of the distances each tile must move to reach its
+     *   goal position
+     * - kLinearConflict: Manhattan plus two moves for every tile that must
+     *   leave its goal row or column to let another tile pass
+     * - kWalkingDistance: precomputed vertical plus horizontal walking
+     *   distance
+     *
+     * All of them are admissible for A* search. Manhattan and linear
+     * conflict use the HeuristicKernel lookup tables (SIMD when available)
+     * for boards up to HeuristicKernel::kMaxDimension.
      *
      * @param state The state to evaluate
      * @return Manhattan distance to goal (admissible heuristic)
      */
     CostType Heuristic(const State& state) const override;
 
+    /**
+     * @brief Maps a state to the representative of its symmetry class
+     *
+     * The goal (blank in the top-left corner, tiles in row-major order) is
+     * symmetric under reflection in the main diagonal, once tiles are
+     * renamed after their reflected goal squares: tile r * n + c becomes
+     * c * n + r. Reflecting a state this way maps moves to moves and the
+     * goal to itself. The representative is the smaller of the state and
+     * its reflection.
+     *
+     * @param state The state to map
+     * @return The state or its reflection
+     */
+    State Canonicalize(const State& state) const override;
+
     /**
      * @brief Gets the grid dimension
      * @return The dimension of the grid (3 for 3x3, 4 for 4x4, etc.)
      */
     uint64_t GetDimension() const { return dimension_; }
 
+    /**
+     * @brief Gets the heuristics combined by this problem
+     * @return The selected heuristic flags
+     */
+    HeuristicType GetHeuristics() const { return heuristics_; }
+
     /**
      * @brief Finds the position of the blank tile
      *
@@ -0,0 +1,126 @@
+#include "walking_distance.h"
+
+#include <map>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+
+using namespace sliding_tile;
+
+WalkingDistanceTable::WalkingDistanceTable(std::size_t dimension)
+    : dimension_(dimension) {
+    if (dimension_ < 2 || dimension_ > kMaxDimension)
+        throw std::invalid_argument(
+            "WalkingDistanceTable: dimension must be between 2 and 4");
+
+    // Goal places tile t at index t
+    std::size_t num_cells = dimension_ * dimension_;
+    goal_line_.resize(num_cells);
+    goal_cross_.resize(num_cells);
+    for (std::size_t tile = 0; tile < num_cells; ++tile) {
+        goal_line_[tile] = static_cast<uint8_t>(tile / dimension_);
+        goal_cross_[tile] = static_cast<uint8_t>(tile % dimension_);
+    }
+
+    Build();
+}
+
+std::shared_ptr<const WalkingDistanceTable> WalkingDistanceTable::Get(
+    std::size_t dimension) {
+    static std::mutex mutex;
+    static std::map<std::size_t, std::shared_ptr<const WalkingDistanceTable>>
+        tables;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& table = tables[dimension];
+    if (!table) table = std::make_shared<const WalkingDistanceTable>(dimension);
+    return table;
+}
+
+uint64_t WalkingDistanceTable::Encode(const uint8_t* counts,
+                                      std::size_t blank_line) const {
+    uint64_t key = 0;
+    std::size_t entries = dimension_ * dimension_;
+    for (std::size_t i = 0; i < entries; ++i)
+        key |= static_cast<uint64_t>(counts[i]) << (kCountBits * i);
+    return key | (static_cast<uint64_t>(blank_line) << (kCountBits * entries));
+}
+
+std::size_t WalkingDistanceTable::Decode(uint64_t key, uint8_t* counts) const {
+    std::size_t entries = dimension_ * dimension_;
+    for (std::size_t i = 0; i < entries; ++i)
+        counts[i] = (key >> (kCountBits * i)) & ((1 << kCountBits) - 1);
+    return static_cast<std::size_t>(key >> (kCountBits * entries));
+}
+
+void WalkingDistanceTable::Build() {
+    const std::size_t n = dimension_;
+    uint8_t counts[kMaxDimension * kMaxDimension] = {0};
+
+    // Goal: every line holds its own tiles, the first one also the blank
+    for (std::size_t line = 0; line < n; ++line)
+        counts[line * n + line] = static_cast<uint8_t>(n);
+    counts[0] = static_cast<uint8_t>(n - 1);
+
+    uint64_t goal = Encode(counts, 0);
+    distances_[goal] = 0;
+
+    std::queue<uint64_t> frontier;
+    frontier.push(goal);
+
+    while (!frontier.empty()) {
+        uint64_t key = frontier.front();
+        frontier.pop();
+
+        uint8_t distance = distances_[key];
+        std::size_t blank = Decode(key, counts);
+
+        // The blank swaps with any tile of an adjacent line; only the goal
+        // line of that tile matters to the abstraction
+        for (int step : {-1, 1}) {
+            if ((step < 0 && blank == 0) || (step > 0 && blank == n - 1))
+                continue;
+            std::size_t next = blank + step;
+            for (std::size_t g = 0; g < n; ++g) {
+                if (counts[next * n + g] == 0) continue;
+
+                --counts[next * n + g];
+                ++counts[blank * n + g];
+                uint64_t child = Encode(counts, next);
+                if (distances_.emplace(child, distance + 1).second)
+                    frontier.push(child);
+                ++counts[next * n + g];
+                --counts[blank * n + g];
+            }
+        }
+    }
+}
+
+int WalkingDistanceTable::Lookup(const uint8_t* board) const {
+    const std::size_t n = dimension_;
+    uint8_t row_counts[kMaxDimension * kMaxDimension] = {0};
+    uint8_t col_counts[kMaxDimension * kMaxDimension] = {0};
+    std::size_t blank_row = 0, blank_col = 0;
+
+    for (std::size_t row = 0; row < n; ++row) {
+        for (std::size_t col = 0; col < n; ++col) {
+            uint8_t tile = board[row * n + col];
+            if (tile == 0) {
+                blank_row = row;
+                blank_col = col;
+                continue;
+            }
+            ++row_counts[row * n + goal_line_[tile]];
+            ++col_counts[col * n + goal_cross_[tile]];
+        }
+    }
+
+    // Patterns outside the table cannot come from a real board, but 0 keeps
+    // the heuristic admissible either way
+    int total = 0;
+    auto vertical = distances_.find(Encode(row_counts, blank_row));
+    if (vertical != distances_.end()) total += vertical->second;
+    auto horizontal = distances_.find(Encode(col_counts, blank_col));
+    if (horizontal != distances_.end()) total += horizontal->second;
+    return total;
+}
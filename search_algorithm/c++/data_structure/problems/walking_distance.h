@@ -0,0 +1,110 @@
+/**
+ * @file walking_distance.h
+ * @brief Precomputed walking distance table for the sliding tile puzzle
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_WALKING_DISTANCE_H_
+#define SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_WALKING_DISTANCE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace sliding_tile {
+
+/**
+ * @brief Walking distance heuristic backed by a breadth-first built table
+ *
+ * The walking distance abstracts a board into an N x N matrix that counts,
+ * for every row, how many tiles of each goal row it holds, plus the row of
+ * the blank tile. Only vertical moves change that matrix, so the exact number
+ * of moves to solve the abstraction (precomputed by a BFS from the goal) is a
+ * lower bound on the vertical moves of the real puzzle. The goal layout is
+ * symmetric (blank first, tile t at index t), so the same table applied to
+ * columns bounds the horizontal moves, and the sum of both is admissible.
+ *
+ * @note Tables are only built for dimensions up to kMaxDimension; the 5x5
+ * abstraction is too large to precompute here.
+ */
+class WalkingDistanceTable {
+   public:
+    static constexpr std::size_t kMaxDimension = 4;
+
+    /**
+     * @brief Builds the table for a board dimension
+     *
+     * @param dimension Grid size (3 for 3x3, 4 for 4x4)
+     * @throws std::invalid_argument if dimension is below 2 or above
+     * kMaxDimension
+     */
+    explicit WalkingDistanceTable(std::size_t dimension);
+
+    /**
+     * @brief Gets the table for a dimension, building it on first use
+     *
+     * Tables are shared by every problem of the same dimension. Safe to call
+     * from multiple threads.
+     *
+     * @param dimension Grid size
+     * @return Shared, immutable table
+     * @throws std::invalid_argument if the dimension is not supported
+     */
+    static std::shared_ptr<const WalkingDistanceTable> Get(
+        std::size_t dimension);
+
+    /**
+     * @brief Gets the grid dimension the table was built for
+     * @return The dimension
+     */
+    std::size_t GetDimension() const { return dimension_; }
+
+    /**
+     * @brief Gets the number of abstract patterns in the table
+     * @return Number of entries
+     */
+    std::size_t GetNumPatterns() const { return distances_.size(); }
+
+    /**
+     * @brief Computes the walking distance of a board
+     * @param board Row-major board of N * N bytes, 0 is the blank tile
+     * @return Vertical plus horizontal walking distance
+     */
+    int Lookup(const uint8_t* board) const;
+
+   private:
+    static constexpr int kCountBits = 3;  ///< Bits per matrix entry
+
+    std::size_t dimension_;
+    std::vector<uint8_t> goal_line_;    ///< Tile -> goal row
+    std::vector<uint8_t> goal_cross_;   ///< Tile -> goal column
+    std::unordered_map<uint64_t, uint8_t> distances_;  ///< Pattern -> moves
+
+    /**
+     * @brief Packs a count matrix and the blank line into a table key
+     * @param counts N x N matrix, counts[line * N + goal_line]
+     * @param blank_line Line holding the blank tile
+     * @return The key
+     */
+    uint64_t Encode(const uint8_t* counts, std::size_t blank_line) const;
+
+    /**
+     * @brief Unpacks a table key
+     * @param key The key
+     * @param counts Output N x N matrix
+     * @return Line holding the blank tile
+     */
+    std::size_t Decode(uint64_t key, uint8_t* counts) const;
+
+    /**
+     * @brief Fills distances_ with a BFS from the goal pattern
+     */
+    void Build();
+};
+
+}  // namespace sliding_tile
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_PROBLEMS_WALKING_DISTANCE_H_
@@ -0,0 +1,151 @@
+/**
+ * @file reached_set.h
+ * @brief Set of states a search has already reached
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_REACHED_SET_H_
+#define SEARCH_ALG_DATA_STRUCTURE_REACHED_SET_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "fingerprint_set.h"
+#include "node.h"
+#include "problem.h"
+#include "state_store.h"
+
+/**
+ * @brief Reached states of a graph search, optionally one per symmetry class
+ *
+ * States are interned in a StateStore: each is kept once, in contiguous
+ * blocks, under a 32-bit id. InsertNode lets the node refer to that copy
+ * instead of keeping its own.
+ *
+ * With reduce_symmetry set, states are stored as Problem::Canonicalize maps
+ * them, so reaching any state symmetric to a stored one counts as a
+ * duplicate.
+ *
+ * With fingerprints set, only 64-bit fingerprints are kept (FingerprintSet),
+ * optionally behind a Bloom filter: about 11 to 21 bytes per state instead
+ * of a full copy, at a tiny risk of taking a new state for a reached one.
+ * GetStates() is then empty.
+ *
+ * @tparam TState Type representing the problem state
+ * @tparam TAction Type representing actions that can be taken
+ * @tparam CostType Type representing the cost of actions
+ */
+template <typename TState, typename TAction, typename CostType>
+class ReachedSet {
+   public:
+    using StoreType = StateStore<TState>;
+    using NodeType = Node<TState, TAction, CostType>;
+
+    /**
+     * @param problem Problem providing Canonicalize, must outlive the set
+     * @param reduce_symmetry Store one state per symmetry class
+     * @param fingerprints Store state fingerprints instead of states
+     * @param bloom_bits_per_state Bloom filter bits per state in front of
+     * the fingerprints, 0 for no filter
+     */
+    explicit ReachedSet(const Problem<TState, TAction, CostType>& problem,
+                        bool reduce_symmetry = false, bool fingerprints = false,
+                        std::size_t bloom_bits_per_state = 0)
+        : problem_(&problem), reduce_symmetry_(reduce_symmetry) {
+        if (fingerprints)
+            fingerprints_ =
+                std::make_unique<FingerprintSet>(bloom_bits_per_state);
+    }
+
+    /**
+     * @brief Adds a state
+     * @param state The state
+     * @return false if it (or a symmetric state) was already reached
+     */
+    bool Insert(const TState& state) {
+        if (fingerprints_) return fingerprints_->Insert(Fingerprint(state));
+        if (reduce_symmetry_)
+            return states_.Intern(problem_->Canonicalize(state)).second;
+        return states_.Intern(state).second;
+    }
+
+    /**
+     * @brief Adds a node's state
+     *
+     * Without symmetry reduction, a state that owns heap memory (e.g. a
+     * vector grid) is moved into the set and the node refers to the stored
+     * copy (Node::InternState); small self-contained states are copied. With
+     * symmetry reduction the set holds the representative, not the node's
+     * state, so the node keeps its own.
+     *
+     * @param node The node
+     * @return false if its state (or a symmetric state) was already reached
+     */
+    bool InsertNode(NodeType* node) {
+        if (fingerprints_ || reduce_symmetry_)
+            return Insert(node->GetState());
+        return node->InternState(&states_).second;
+    }
+
+    /**
+     * @brief Tests whether a state (or a symmetric state) was reached
+     * @param state The state
+     * @return true if reached
+     */
+    bool Contains(const TState& state) const {
+        if (fingerprints_) return fingerprints_->Contains(Fingerprint(state));
+        if (reduce_symmetry_)
+            return states_.Find(problem_->Canonicalize(state)) !=
+                   StoreType::kNoId;
+        return states_.Find(state) != StoreType::kNoId;
+    }
+
+    /**
+     * @brief Gets the number of stored states
+     * @return Stored states, one per class with reduce_symmetry
+     */
+    std::size_t GetSize() const {
+        return fingerprints_ ? fingerprints_->GetSize() : states_.GetSize();
+    }
+
+    /**
+     * @brief Gets the memory the set holds
+     * @return Bytes, not counting heap memory stored states own
+     */
+    std::size_t GetMemoryBytes() const {
+        return fingerprints_ ? fingerprints_->GetMemoryBytes()
+                             : states_.GetMemoryBytes();
+    }
+
+    /**
+     * @brief Gets the fingerprint table, if fingerprints are stored
+     * @return The table, nullptr when full states are stored
+     */
+    const FingerprintSet* GetFingerprints() const {
+        return fingerprints_.get();
+    }
+
+    /**
+     * @brief Gets the stored states, as Insert stored them
+     * @return The underlying store
+     */
+    StoreType& GetStates() { return states_; }
+    const StoreType& GetStates() const { return states_; }
+
+   private:
+    const Problem<TState, TAction, CostType>* problem_;
+    bool reduce_symmetry_;
+    StoreType states_;
+    std::unique_ptr<FingerprintSet> fingerprints_;
+
+    /// Fingerprint of the state as stored, i.e. of its representative with
+    /// symmetry reduction
+    uint64_t Fingerprint(const TState& state) const {
+        if (reduce_symmetry_)
+            return FingerprintSet::Fingerprint(problem_->Canonicalize(state));
+        return FingerprintSet::Fingerprint(state);
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_REACHED_SET_H_
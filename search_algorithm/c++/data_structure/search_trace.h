@@ -0,0 +1,218 @@
+/**
+ * @file search_trace.h
+ * @brief Binary trace of search events for offline analysis
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_SEARCH_TRACE_H_
+#define SEARCH_ALG_DATA_STRUCTURE_SEARCH_TRACE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "node.h"
+#include "problem.h"
+
+/**
+ * @brief What happened to a node
+ */
+enum class TraceEvent : uint8_t {
+    kGenerate = 0,   ///< Created and added to the frontier
+    kExpand = 1,     ///< Successors generated
+    kDuplicate = 2,  ///< Created but dropped, its state was already reached
+    kPrune = 3,      ///< Skipped by a cycle check or transposition table
+    kGoal = 4,       ///< Passed the goal test
+};
+
+/**
+ * @brief One fixed-size trace record
+ *
+ * Node ids are assigned by the TraceWriter, counting up from 1 in the order
+ * nodes are created, and are never reused within a trace, so parent ids
+ * rebuild the search tree. The root has parent id 0.
+ *
+ * The heuristic is evaluated once per node, for the record that gives the
+ * node its id; later records of the node carry NaN and readers look h up
+ * by id.
+ */
+struct TraceRecord {
+    uint64_t node_id;
+    uint64_t parent_id;
+    float g;         ///< Path cost
+    float h;         ///< Heuristic value, NaN after the node's first record
+    uint32_t depth;  ///< Depth in the search tree
+    TraceEvent event;
+    uint8_t reserved[3];
+};
+
+static_assert(sizeof(TraceRecord) == 32, "Trace records must stay 32 bytes");
+
+/**
+ * @brief Buffered writer of trace records
+ *
+ * Records are appended to an in-memory buffer and written to the file a
+ * block at a time, so tracing a search costs one copy per event. The file
+ * starts with a small header (magic, version, record size).
+ *
+ * @note Not thread-safe; use one writer per thread.
+ */
+class TraceWriter {
+   public:
+    static constexpr uint32_t kMagic = 0x45434154;  // "TACE"
+    static constexpr uint32_t kVersion = 3;
+
+    /**
+     * @brief Creates the trace file
+     * @param path Destination file, overwritten
+     * @param buffer_records Records buffered between two writes
+     * @throws std::runtime_error if the file cannot be created
+     */
+    explicit TraceWriter(const std::string& path,
+                         std::size_t buffer_records = 1 << 15)
+        : file_(std::fopen(path.c_str(), "wb"), &std::fclose) {
+        if (!file_)
+            throw std::runtime_error("TraceWriter: cannot open " + path);
+        buffer_.reserve(buffer_records);
+
+        uint32_t header[3] = {kMagic, kVersion, sizeof(TraceRecord)};
+        std::fwrite(header, sizeof(header), 1, file_.get());
+    }
+
+    ~TraceWriter() { Flush(); }
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    /**
+     * @brief Appends a record
+     * @param record The record
+     */
+    void Write(const TraceRecord& record) {
+        buffer_.push_back(record);
+        ++num_records_;
+        if (buffer_.size() == buffer_.capacity()) Flush();
+    }
+
+    /**
+     * @brief Hands out the next node id
+     * @return The id, counting up from 1
+     * @throws std::length_error past 2^32 - 1 nodes, the ids nodes can hold
+     */
+    uint32_t NewNodeId() {
+        if (next_node_id_ == 0)
+            throw std::length_error("TraceWriter: more than 2^32 - 1 nodes");
+        return next_node_id_++;
+    }
+
+    /**
+     * @brief Writes the buffered records to the file
+     */
+    void Flush() {
+        if (buffer_.empty()) return;
+        std::fwrite(buffer_.data(), sizeof(TraceRecord), buffer_.size(),
+                    file_.get());
+        std::fflush(file_.get());
+        buffer_.clear();
+    }
+
+    /**
+     * @brief Gets the number of records written so far
+     * @return Record count
+     */
+    uint64_t GetNumRecords() const { return num_records_; }
+
+   private:
+    std::unique_ptr<std::FILE, decltype(&std::fclose)> file_;
+    std::vector<TraceRecord> buffer_;
+    uint64_t num_records_ = 0;
+    uint32_t next_node_id_ = 1;  ///< 0 once the ids have run out
+};
+
+/**
+ * @brief Block reader of trace files written by TraceWriter
+ */
+class TraceReader {
+   public:
+    /**
+     * @brief Opens a trace and checks its header
+     * @param path Trace file
+     * @throws std::runtime_error if the file is missing or not a trace
+     */
+    explicit TraceReader(const std::string& path)
+        : file_(std::fopen(path.c_str(), "rb"), &std::fclose) {
+        if (!file_)
+            throw std::runtime_error("TraceReader: cannot open " + path);
+
+        uint32_t header[3] = {0, 0, 0};
+        if (std::fread(header, sizeof(header), 1, file_.get()) != 1 ||
+            header[0] != TraceWriter::kMagic ||
+            header[1] != TraceWriter::kVersion ||
+            header[2] != sizeof(TraceRecord))
+            throw std::runtime_error("TraceReader: not a trace: " + path);
+    }
+
+    /**
+     * @brief Reads the next block of records
+     * @param out_records Output: the records read, empty at the end
+     * @param max_records Block size
+     * @return false at the end of the trace
+     */
+    bool ReadBlock(std::vector<TraceRecord>* out_records,
+                   std::size_t max_records = 1 << 15) {
+        out_records->resize(max_records);
+        std::size_t read = std::fread(out_records->data(), sizeof(TraceRecord),
+                                      max_records, file_.get());
+        out_records->resize(read);
+        return read > 0;
+    }
+
+   private:
+    std::unique_ptr<std::FILE, decltype(&std::fclose)> file_;
+};
+
+/**
+ * @brief Records an event of a node, if tracing is enabled
+ *
+ * The node keeps its trace id (Node::SetTraceId), so naming it costs no
+ * lookup. A kGenerate or kDuplicate record gives the node a new id, as does
+ * the first record of a node never traced before (e.g. one restored from a
+ * checkpoint); the heuristic is evaluated for these records only. A parent
+ * never traced gets an id without a record.
+ *
+ * @param writer Trace writer, nullptr to do nothing
+ * @param event What happened to the node
+ * @param node The node
+ * @param problem Problem providing the heuristic
+ */
+template <typename TState, typename TAction, typename CostType>
+void TraceNode(TraceWriter* writer, TraceEvent event,
+               const Node<TState, TAction, CostType>& node,
+               const Problem<TState, TAction, CostType>& problem) {
+    if (!writer) return;
+
+    TraceRecord record{};
+    record.h = std::numeric_limits<float>::quiet_NaN();
+    if (event == TraceEvent::kGenerate || event == TraceEvent::kDuplicate ||
+        node.GetTraceId() == 0) {
+        node.SetTraceId(writer->NewNodeId());
+        record.h = static_cast<float>(problem.Heuristic(node.GetState()));
+    }
+    const Node<TState, TAction, CostType>* parent = node.GetParent().get();
+    if (parent && parent->GetTraceId() == 0)
+        parent->SetTraceId(writer->NewNodeId());
+
+    record.node_id = node.GetTraceId();
+    record.parent_id = parent ? parent->GetTraceId() : 0;
+    record.g = static_cast<float>(node.GetPathCost());
+    record.depth = node.GetDepth();
+    record.event = event;
+    writer->Write(record);
+}
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_SEARCH_TRACE_H_
@@ -0,0 +1,93 @@
+/**
+ * @file serializer.h
+ * @brief Binary serialization of states and actions
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_SERIALIZER_H_
+#define SEARCH_ALG_DATA_STRUCTURE_SERIALIZER_H_
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Writes and reads values in native binary layout
+ *
+ * Trivially copyable types (numbers, enums, plain action structs) are copied
+ * byte for byte and vectors are written as their size followed by their
+ * elements. Other state types specialize Serializer next to their
+ * definition.
+ *
+ * @note The format is meant to be read back by the same build on the same
+ * machine, not exchanged between architectures.
+ *
+ * @tparam T Type to serialize
+ */
+template <typename T, typename = void>
+struct Serializer;
+
+template <typename T>
+struct Serializer<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+    static void Write(std::ostream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static void Read(std::istream& in, T* value) {
+        if (!in.read(reinterpret_cast<char*>(value), sizeof(T)))
+            throw std::runtime_error("Serializer: unexpected end of input");
+    }
+};
+
+template <typename T, typename Allocator>
+struct Serializer<std::vector<T, Allocator>> {
+    static void Write(std::ostream& out,
+                      const std::vector<T, Allocator>& value) {
+        Serializer<uint64_t>::Write(out, value.size());
+        if constexpr (std::is_trivially_copyable_v<T>)
+            out.write(reinterpret_cast<const char*>(value.data()),
+                      value.size() * sizeof(T));
+        else
+            for (const T& element : value) Serializer<T>::Write(out, element);
+    }
+
+    static void Read(std::istream& in, std::vector<T, Allocator>* value) {
+        uint64_t size = 0;
+        Serializer<uint64_t>::Read(in, &size);
+        value->resize(size);
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (!in.read(reinterpret_cast<char*>(value->data()),
+                         size * sizeof(T)))
+                throw std::runtime_error("Serializer: unexpected end of input");
+        } else {
+            for (T& element : *value) Serializer<T>::Read(in, &element);
+        }
+    }
+};
+
+/**
+ * @brief Writes a value with its Serializer
+ * @param out Output stream
+ * @param value The value
+ */
+template <typename T>
+void Serialize(std::ostream& out, const T& value) {
+    Serializer<T>::Write(out, value);
+}
+
+/**
+ * @brief Reads a value with its Serializer
+ * @param in Input stream
+ * @param value Output: the value read
+ * @throws std::runtime_error if the input ends early
+ */
+template <typename T>
+void Deserialize(std::istream& in, T* value) {
+    Serializer<T>::Read(in, value);
+}
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_SERIALIZER_H_
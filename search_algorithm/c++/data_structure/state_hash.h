@@ -0,0 +1,88 @@
+/**
+ * @file state_hash.h
+ * @brief Hash functor for search states
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_STATE_HASH_H_
+#define SEARCH_ALG_DATA_STRUCTURE_STATE_HASH_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Mixes a value into a running hash
+ * @param seed Running hash
+ * @param value Hash of the next element
+ * @return The combined hash
+ */
+inline std::size_t HashCombine(std::size_t seed, std::size_t value) {
+    // Spread the value over all bits first: std::hash of small integers
+    // (tiles, coordinates) is the identity, and combining those directly
+    // makes distinct sequences collide even in 64 bits
+    uint64_t mixed = static_cast<uint64_t>(value) * 0xbf58476d1ce4e5b9ULL;
+    mixed ^= mixed >> 31;
+    return seed ^ (static_cast<std::size_t>(mixed) + 0x9e3779b97f4a7c15ULL +
+                   (seed << 6) + (seed >> 2));
+}
+
+/**
+ * @brief Hash functor used by reached sets and transposition tables
+ *
+ * Falls back to std::hash. Containers are hashed element by element, and
+ * states that maintain their own key (a GetHash() member, e.g. incremental
+ * Zobrist keys) are used as is, without touching their contents.
+ *
+ * @tparam TState Type representing the problem state
+ */
+template <typename TState, typename = void>
+struct StateHash {
+    std::size_t operator()(const TState& state) const {
+        return std::hash<TState>{}(state);
+    }
+};
+
+/**
+ * @brief States carrying a precomputed hash
+ */
+template <typename TState>
+struct StateHash<
+    TState, std::void_t<decltype(std::declval<const TState&>().GetHash())>> {
+    std::size_t operator()(const TState& state) const {
+        return static_cast<std::size_t>(state.GetHash());
+    }
+};
+
+/**
+ * @brief Vector states, e.g. grid rows
+ */
+template <typename T, typename Allocator>
+struct StateHash<std::vector<T, Allocator>> {
+    std::size_t operator()(const std::vector<T, Allocator>& state) const {
+        std::size_t seed = state.size();
+        for (const T& element : state)
+            seed = HashCombine(seed, StateHash<T>{}(element));
+        return seed;
+    }
+};
+
+/**
+ * @brief Fixed-size array states
+ */
+template <typename T, std::size_t N>
+struct StateHash<std::array<T, N>> {
+    std::size_t operator()(const std::array<T, N>& state) const {
+        std::size_t seed = N;
+        for (const T& element : state)
+            seed = HashCombine(seed, StateHash<T>{}(element));
+        return seed;
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_STATE_HASH_H_
@@ -0,0 +1,176 @@
+/**
+ * @file state_store.h
+ * @brief Hash-consed storage of states, addressed by 32-bit ids
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_STATE_STORE_H_
+#define SEARCH_ALG_DATA_STRUCTURE_STATE_STORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "state_hash.h"
+
+/**
+ * @brief Stores each distinct state once and names it by a dense id
+ *
+ * States live in blocks of kBlockSize contiguous slots that never move, so
+ * references returned by Get() stay valid for the lifetime of the store and
+ * nodes can point at them instead of holding a copy.
+ *
+ * The index is an open-addressing table of (id, hash tag) pairs, 8 bytes
+ * per slot, kept at most half full. A lookup compares full states only when
+ * the 32-bit tags match. The tags also place the entries when the table
+ * grows, so states are never hashed twice.
+ *
+ * @tparam TState Type representing the problem state
+ */
+template <typename TState>
+class StateStore {
+   public:
+    static constexpr uint32_t kNoId = UINT32_MAX;  ///< "Not stored"
+    static constexpr std::size_t kBlockSize = 4096;
+
+    /**
+     * @param expected_size Number of states to make room for up front
+     */
+    explicit StateStore(std::size_t expected_size = 0) {
+        std::size_t capacity = 16;
+        while (capacity < 2 * expected_size) capacity *= 2;
+        slots_.assign(capacity, Slot{kNoId, 0});
+    }
+
+    StateStore(const StateStore&) = delete;
+    StateStore& operator=(const StateStore&) = delete;
+
+    /**
+     * @brief Stores a state unless an equal one is stored already
+     * @param state The state
+     * @return Id of the stored state, and true if it was added now
+     * @throws std::length_error if the store holds 2^32 - 1 states
+     */
+    std::pair<uint32_t, bool> Intern(const TState& state) {
+        return InternImpl(state);
+    }
+
+    /**
+     * @brief Stores a state unless an equal one is stored already
+     * @param state The state; only moved from if it is added
+     * @return Id of the stored state, and true if it was added now
+     * @throws std::length_error if the store holds 2^32 - 1 states
+     */
+    std::pair<uint32_t, bool> Intern(TState&& state) {
+        return InternImpl(std::move(state));
+    }
+
+    /**
+     * @brief Looks up a state
+     * @param state The state
+     * @return Its id, kNoId if not stored
+     */
+    uint32_t Find(const TState& state) const {
+        uint32_t tag = Tag(state);
+        for (std::size_t i = tag & (slots_.size() - 1);;
+             i = (i + 1) & (slots_.size() - 1)) {
+            const Slot& slot = slots_[i];
+            if (slot.id == kNoId) return kNoId;
+            if (slot.tag == tag && Get(slot.id) == state) return slot.id;
+        }
+    }
+
+    /**
+     * @brief Gets a stored state
+     * @param id Id returned by Intern
+     * @return The state, valid as long as the store
+     */
+    const TState& Get(uint32_t id) const {
+        return blocks_[id / kBlockSize][id % kBlockSize];
+    }
+
+    /**
+     * @brief Gets the number of stored states
+     * @return Stored states; their ids are 0 to GetSize() - 1
+     */
+    std::size_t GetSize() const { return size_; }
+
+    /**
+     * @brief Gets the memory held by the blocks and the index
+     * @return Bytes, not counting heap memory the states themselves own
+     */
+    std::size_t GetMemoryBytes() const {
+        return blocks_.size() * kBlockSize * sizeof(TState) +
+               slots_.size() * sizeof(Slot);
+    }
+
+    /**
+     * @brief Removes every state
+     */
+    void Clear() {
+        blocks_.clear();
+        slots_.assign(16, Slot{kNoId, 0});
+        size_ = 0;
+    }
+
+   private:
+    /**
+     * @brief Index entry
+     */
+    struct Slot {
+        uint32_t id;   ///< Stored state, kNoId if the slot is free
+        uint32_t tag;  ///< High bits of the state's hash
+    };
+
+    std::vector<std::vector<TState>> blocks_;  ///< Reserved, never reallocate
+    std::vector<Slot> slots_;                  ///< Size is a power of two
+    std::size_t size_ = 0;
+
+    static uint32_t Tag(const TState& state) {
+        uint64_t hash = static_cast<uint64_t>(StateHash<TState>{}(state));
+        // Mix, so the low bits used for the position depend on every bit
+        hash *= 0x9e3779b97f4a7c15ULL;
+        return static_cast<uint32_t>(hash >> 32);
+    }
+
+    template <typename T>
+    std::pair<uint32_t, bool> InternImpl(T&& state) {
+        uint32_t tag = Tag(state);
+        std::size_t mask = slots_.size() - 1;
+        std::size_t i = tag & mask;
+        for (; slots_[i].id != kNoId; i = (i + 1) & mask) {
+            if (slots_[i].tag == tag && Get(slots_[i].id) == state)
+                return {slots_[i].id, false};
+        }
+
+        if (size_ >= kNoId)
+            throw std::length_error("StateStore: more than 2^32 - 1 states");
+        if (size_ % kBlockSize == 0) {
+            blocks_.emplace_back();
+            blocks_.back().reserve(kBlockSize);
+        }
+        blocks_.back().push_back(std::forward<T>(state));
+
+        uint32_t id = static_cast<uint32_t>(size_++);
+        slots_[i] = Slot{id, tag};
+        if (2 * size_ > slots_.size()) Grow();
+        return {id, true};
+    }
+
+    void Grow() {
+        std::vector<Slot> old_slots(2 * slots_.size(), Slot{kNoId, 0});
+        old_slots.swap(slots_);
+        std::size_t mask = slots_.size() - 1;
+        for (const Slot& slot : old_slots) {
+            if (slot.id == kNoId) continue;
+            std::size_t i = slot.tag & mask;
+            while (slots_[i].id != kNoId) i = (i + 1) & mask;
+            slots_[i] = slot;
+        }
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_STATE_STORE_H_
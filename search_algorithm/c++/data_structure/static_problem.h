@@ -0,0 +1,168 @@
+/**
+ * @file static_problem.h
+ * @brief Opt-in static dispatch of problem calls
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_STATIC_PROBLEM_H_
+#define SEARCH_ALG_DATA_STRUCTURE_STATIC_PROBLEM_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "problem.h"
+
+/**
+ * @brief Base of problems that searches may call without the vtable
+ *
+ * A problem class opts in by deriving from StaticProblem with itself as
+ * Derived (CRTP) instead of from Problem directly. It stays a Problem and
+ * works with every search as before. Searches templated on the problem type
+ * (BestFirstSearch, comparators taking a problem type) call such a class
+ * through ProblemDispatch, which resolves each call at compile time: no
+ * indirect call, and the body can be inlined where it is visible.
+ *
+ * A class derived further (e.g. to instrument a method) is called through
+ * the vtable again when it is passed as itself, so its overrides still run.
+ * Passing it as a reference to the opted-in class would bypass them.
+ *
+ * @tparam Derived The problem class deriving from this one
+ * @tparam TState Type representing a state in the problem space
+ * @tparam TAction Type representing actions that can be applied to states
+ * @tparam CostType Type representing the cost of actions
+ */
+template <typename Derived, typename TState, typename TAction,
+          typename CostType>
+class StaticProblem : public Problem<TState, TAction, CostType> {
+   public:
+    /// The class whose member functions are called statically
+    using StaticDerived = Derived;
+
+    using Problem<TState, TAction, CostType>::Problem;
+};
+
+/**
+ * @brief Tells whether calls to a problem type can be bound statically
+ *
+ * True for a class that derives from StaticProblem with itself as Derived,
+ * false for the Problem base and for any class derived from such a class.
+ */
+template <typename TProblem, typename = void>
+struct IsStaticProblem : std::false_type {};
+
+template <typename TProblem>
+struct IsStaticProblem<TProblem, std::void_t<typename TProblem::StaticDerived>>
+    : std::is_same<typename TProblem::StaticDerived, TProblem> {};
+
+/**
+ * @brief Tells whether a problem type evaluates several states in one call
+ *
+ * True if TProblem has a member
+ * HeuristicBatch(const std::vector<const TState*>&, std::vector<TCost>*).
+ */
+template <typename TProblem, typename TState, typename TCost,
+          typename = void>
+struct HasHeuristicBatch : std::false_type {};
+
+template <typename TProblem, typename TState, typename TCost>
+struct HasHeuristicBatch<
+    TProblem, TState, TCost,
+    std::void_t<decltype(std::declval<const TProblem&>().HeuristicBatch(
+        std::declval<const std::vector<const TState*>&>(),
+        std::declval<std::vector<TCost>*>()))>> : std::true_type {};
+
+/**
+ * @brief Calls into a problem of static type TProblem
+ *
+ * For a StaticProblem the calls are qualified with the class name
+ * (problem.TProblem::Heuristic(state)), which C++ binds at compile time.
+ * For any other type they are ordinary virtual calls.
+ *
+ * @tparam TProblem Static type of the problem
+ */
+template <typename TProblem>
+struct ProblemDispatch {
+    static constexpr bool kStatic = IsStaticProblem<TProblem>::value;
+
+    template <typename TState>
+    static bool IsGoal(const TProblem& problem, const TState& state) {
+        if constexpr (kStatic)
+            return problem.TProblem::IsGoal(state);
+        else
+            return problem.IsGoal(state);
+    }
+
+    template <typename TState>
+    static auto GetActions(const TProblem& problem, const TState& state) {
+        if constexpr (kStatic)
+            return problem.TProblem::GetActions(state);
+        else
+            return problem.GetActions(state);
+    }
+
+    template <typename TState, typename TAction>
+    static auto GetResult(const TProblem& problem, const TState& state,
+                          const TAction& action) {
+        if constexpr (kStatic)
+            return problem.TProblem::GetResult(state, action);
+        else
+            return problem.GetResult(state, action);
+    }
+
+    template <typename TState, typename TAction>
+    static auto GetActionCost(const TProblem& problem, const TState& state,
+                              const TAction& action, const TState& new_state) {
+        if constexpr (kStatic)
+            return problem.TProblem::GetActionCost(state, action, new_state);
+        else
+            return problem.GetActionCost(state, action, new_state);
+    }
+
+    template <typename TState>
+    static auto Canonicalize(const TProblem& problem, const TState& state) {
+        if constexpr (kStatic)
+            return problem.TProblem::Canonicalize(state);
+        else
+            return problem.Canonicalize(state);
+    }
+
+    template <typename TState>
+    static auto Heuristic(const TProblem& problem, const TState& state) {
+        if constexpr (kStatic)
+            return problem.TProblem::Heuristic(state);
+        else
+            return problem.Heuristic(state);
+    }
+
+    /**
+     * @brief Evaluates the heuristic of several states, e.g. all children
+     * of an expansion
+     *
+     * A StaticProblem with a HeuristicBatch member (see HasHeuristicBatch)
+     * gets a single call; any other problem, including classes derived from
+     * one, gets one Heuristic call per state.
+     *
+     * @param problem The problem
+     * @param states The states to evaluate
+     * @param out Output: heuristic value of each state, in the same order
+     */
+    template <typename TState, typename TCost>
+    static void HeuristicBatch(const TProblem& problem,
+                               const std::vector<const TState*>& states,
+                               std::vector<TCost>* out) {
+        if constexpr (kStatic &&
+                      HasHeuristicBatch<TProblem, TState, TCost>::value) {
+            problem.TProblem::HeuristicBatch(states, out);
+        } else {
+            out->resize(states.size());
+            for (std::size_t i = 0; i < states.size(); ++i)
+                (*out)[i] = Heuristic(problem, *states[i]);
+        }
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_STATIC_PROBLEM_H_
@@ -0,0 +1,98 @@
+/**
+ * @file successor_generator.h
+ * @brief Lazy, one-at-a-time generation of child nodes
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_SUCCESSOR_GENERATOR_H_
+#define SEARCH_ALG_DATA_STRUCTURE_SUCCESSOR_GENERATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "node.h"
+#include "problem.h"
+#include "static_problem.h"
+
+/**
+ * @brief Yields the children of a node one at a time
+ *
+ * Unlike Node::Expand, which builds every child before returning, a child's
+ * state is only computed when Next() asks for it. A search can stop at the
+ * first goal child without building its siblings, and a depth-first search
+ * can keep one generator per level and descend right away, so only the
+ * children on the current path exist at any time.
+ *
+ * The actions are listed up front (they are small compared to states).
+ *
+ * @tparam TState Type representing the problem state
+ * @tparam TAction Type representing actions that can be taken
+ * @tparam CostType Type representing the cost of actions
+ * @tparam TProblem Static type of the problem, called through
+ * ProblemDispatch
+ */
+template <typename TState, typename TAction, typename CostType,
+          typename TProblem = Problem<TState, TAction, CostType>>
+class SuccessorGenerator {
+   public:
+    using NodeType = Node<TState, TAction, CostType>;
+
+    /**
+     * @param node The node to expand
+     * @param problem Problem providing actions and transitions, must outlive
+     * the generator
+     */
+    SuccessorGenerator(std::shared_ptr<NodeType> node, const TProblem& problem)
+        : node_(std::move(node)),
+          problem_(&problem),
+          actions_(Dispatch::GetActions(problem, node_->GetState())) {}
+
+    /**
+     * @brief Builds the next child
+     *
+     * Actions the problem rejects (GetResult returns nullptr) are skipped.
+     *
+     * @return The child, nullptr once every action has been tried
+     */
+    std::shared_ptr<NodeType> Next() {
+        const TState& state = node_->GetState();
+        while (next_action_ < actions_.size()) {
+            const TAction& action = actions_[next_action_++];
+            std::unique_ptr<TState> new_state =
+                Dispatch::GetResult(*problem_, state, action);
+            if (!new_state) continue;
+
+            CostType cost =
+                node_->GetPathCost() +
+                Dispatch::GetActionCost(*problem_, state, action, *new_state);
+            return std::make_shared<NodeType>(std::move(*new_state), node_,
+                                              action, cost);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Tells whether some actions are still untried
+     * @return true if Next() may still return a child
+     */
+    bool HasNext() const { return next_action_ < actions_.size(); }
+
+    /**
+     * @brief Gets the node being expanded
+     * @return The parent of the generated children
+     */
+    const std::shared_ptr<NodeType>& GetNode() const { return node_; }
+
+   private:
+    using Dispatch = ProblemDispatch<TProblem>;
+
+    std::shared_ptr<NodeType> node_;
+    const TProblem* problem_;
+    std::vector<TAction> actions_;
+    std::size_t next_action_ = 0;
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_SUCCESSOR_GENERATOR_H_
@@ -0,0 +1,214 @@
+/**
+ * @file transposition_table.h
+ * @brief Fixed-size lock-free transposition table
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_TRANSPOSITION_TABLE_H_
+#define SEARCH_ALG_DATA_STRUCTURE_TRANSPOSITION_TABLE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Fixed-capacity hash table from state hashes to search depths
+ *
+ * Entries live in buckets of kBucketSize that share a cache line. Each
+ * entry stores its data word and the key XOR the data word in two atomics,
+ * so a probe that races with a store sees a key mismatch and misses instead
+ * of returning torn data; no locks are taken and the table can be shared by
+ * threads searching the same problem.
+ *
+ * When a bucket is full, a store replaces the entry with the smallest depth,
+ * preferring entries from older generations. The table never grows.
+ *
+ * @note Full 64-bit state hashes are compared, but different states with the
+ * same hash are still confused. Use well mixed hashes (e.g. Zobrist keys).
+ */
+class TranspositionTable {
+   public:
+    static constexpr std::size_t kBucketSize = 4;  ///< Entries per bucket
+
+    /**
+     * @brief Data stored for a state
+     */
+    struct Entry {
+        uint16_t depth = 0;      ///< Search depth the value holds for
+        uint32_t value = 0;      ///< Bound or score, meaning set by caller
+        uint8_t generation = 0;  ///< Generation the entry was stored in
+    };
+
+    /**
+     * @brief Allocates the table
+     * @param num_entries Capacity, rounded up to a power of two buckets
+     */
+    explicit TranspositionTable(std::size_t num_entries)
+        : num_buckets_(RoundUpBuckets(num_entries)),
+          bucket_mask_(num_buckets_ - 1),
+          buckets_(std::make_unique<Bucket[]>(num_buckets_)) {}
+
+    TranspositionTable(const TranspositionTable&) = delete;
+    TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+    /**
+     * @brief Looks up a state
+     * @param key Hash of the state
+     * @param out_entry Output: the stored entry, if found
+     * @return true if the state is in the table
+     */
+    bool Probe(uint64_t key, Entry* out_entry) const {
+        const Bucket& bucket = buckets_[key & bucket_mask_];
+        for (const Slot& slot : bucket.slots) {
+            uint64_t data = slot.data.load(std::memory_order_relaxed);
+            uint64_t check = slot.check.load(std::memory_order_relaxed);
+            if ((data & kValidBit) && (check ^ data) == key) {
+                *out_entry = Unpack(data);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Stores a state, keeping the deeper entry on a hit
+     *
+     * An existing entry of the state is only overwritten by a depth at least
+     * as large or when it belongs to an older generation.
+     *
+     * @param key Hash of the state
+     * @param depth Search depth the value holds for
+     * @param value Bound or score to store
+     */
+    void Store(uint64_t key, uint16_t depth, uint32_t value = 0) {
+        Bucket& bucket = buckets_[key & bucket_mask_];
+        uint8_t generation = generation_.load(std::memory_order_relaxed);
+
+        Slot* victim = nullptr;
+        int victim_score = 0;
+        for (Slot& slot : bucket.slots) {
+            uint64_t data = slot.data.load(std::memory_order_relaxed);
+            uint64_t check = slot.check.load(std::memory_order_relaxed);
+
+            if (!(data & kValidBit)) {
+                victim = &slot;
+                break;
+            }
+
+            Entry entry = Unpack(data);
+            if ((check ^ data) == key) {
+                if (entry.generation == generation && entry.depth > depth)
+                    return;
+                victim = &slot;
+                break;
+            }
+
+            // Shallow and stale entries go first
+            int score = entry.depth +
+                        (entry.generation == generation ? kCurrentBonus : 0);
+            if (!victim || score < victim_score) {
+                victim = &slot;
+                victim_score = score;
+            }
+        }
+
+        uint64_t data = Pack(depth, value, generation);
+        victim->data.store(data, std::memory_order_relaxed);
+        victim->check.store(key ^ data, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Starts a new generation
+     *
+     * Entries from earlier generations stay readable but are the first to be
+     * replaced. Callers that only trust entries of the current search compare
+     * Entry::generation against GetGeneration().
+     */
+    void NewGeneration() {
+        generation_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the current generation
+     * @return Generation stamped on new entries
+     */
+    uint8_t GetGeneration() const {
+        return generation_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Removes every entry
+     * @warning Not safe to call while other threads use the table
+     */
+    void Clear() {
+        for (std::size_t b = 0; b < num_buckets_; ++b) {
+            for (Slot& slot : buckets_[b].slots) {
+                slot.data.store(0, std::memory_order_relaxed);
+                slot.check.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the number of entries the table holds
+     * @return Capacity in entries
+     */
+    std::size_t GetCapacity() const { return num_buckets_ * kBucketSize; }
+
+    /**
+     * @brief Counts the occupied entries (linear scan)
+     * @return Number of valid entries
+     */
+    std::size_t CountEntries() const {
+        std::size_t count = 0;
+        for (std::size_t b = 0; b < num_buckets_; ++b)
+            for (const Slot& slot : buckets_[b].slots)
+                if (slot.data.load(std::memory_order_relaxed) & kValidBit)
+                    ++count;
+        return count;
+    }
+
+   private:
+    // Data word layout: depth [0, 16), generation [16, 24), value [24, 56),
+    // valid bit 56
+    static constexpr uint64_t kValidBit = uint64_t{1} << 56;
+    static constexpr int kCurrentBonus = 1 << 16;  ///< Outranks any depth
+
+    struct Slot {
+        std::atomic<uint64_t> check{0};  ///< Key XOR data
+        std::atomic<uint64_t> data{0};
+    };
+
+    struct alignas(64) Bucket {
+        Slot slots[kBucketSize];
+    };
+
+    std::size_t num_buckets_;
+    std::size_t bucket_mask_;
+    std::unique_ptr<Bucket[]> buckets_;
+    std::atomic<uint8_t> generation_{0};
+
+    static std::size_t RoundUpBuckets(std::size_t num_entries) {
+        std::size_t buckets = 1;
+        while (buckets * kBucketSize < num_entries) buckets <<= 1;
+        return buckets;
+    }
+
+    static uint64_t Pack(uint16_t depth, uint32_t value, uint8_t generation) {
+        return static_cast<uint64_t>(depth) |
+               (static_cast<uint64_t>(generation) << 16) |
+               (static_cast<uint64_t>(value) << 24) | kValidBit;
+    }
+
+    static Entry Unpack(uint64_t data) {
+        Entry entry;
+        entry.depth = static_cast<uint16_t>(data);
+        entry.generation = static_cast<uint8_t>(data >> 16);
+        entry.value = static_cast<uint32_t>(data >> 24);
+        return entry;
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_TRANSPOSITION_TABLE_H_
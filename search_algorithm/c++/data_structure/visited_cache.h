@@ -0,0 +1,101 @@
+/**
+ * @file visited_cache.h
+ * @brief Bounded set of visited states with clock eviction
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_VISITED_CACHE_H_
+#define SEARCH_ALG_DATA_STRUCTURE_VISITED_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "state_hash.h"
+
+/**
+ * @brief Remembers at most a fixed number of states, evicting with the
+ * clock (second-chance) algorithm
+ *
+ * Eviction follows the clock algorithm, an approximation of LRU: every state
+ * has a referenced bit, set when it is inserted or found again. When the
+ * cache is full, a hand sweeps the slots in a circle, clearing set bits, and
+ * evicts the first state whose bit was already clear.
+ *
+ * A forgotten state is treated as new the next time it is reached, so a
+ * search using the cache may explore it again: memory stays bounded at the
+ * price of repeated work.
+ *
+ * @tparam TState Type of the stored states
+ */
+template <typename TState>
+class VisitedCache {
+   public:
+    /**
+     * @param capacity Most states remembered at once
+     * @throws std::invalid_argument if capacity is 0
+     */
+    explicit VisitedCache(std::size_t capacity) : capacity_(capacity) {
+        if (capacity == 0)
+            throw std::invalid_argument("VisitedCache: capacity must be > 0");
+
+        // Never rehashing keeps the iterators in ring_ valid
+        states_.reserve(capacity);
+        ring_.reserve(capacity);
+    }
+
+    /**
+     * @brief Adds a state, evicting another one if the cache is full
+     * @param state The state
+     * @return false if the state was already remembered
+     */
+    bool Insert(const TState& state) {
+        auto found = states_.find(state);
+        if (found != states_.end()) {
+            found->second = true;
+            return false;
+        }
+
+        if (ring_.size() < capacity_) {
+            ring_.push_back(states_.emplace(state, true).first);
+            return true;
+        }
+
+        // Second chance: skip, and clear, recently referenced states
+        while (ring_[hand_]->second) {
+            ring_[hand_]->second = false;
+            hand_ = (hand_ + 1) % ring_.size();
+        }
+        states_.erase(ring_[hand_]);
+        ring_[hand_] = states_.emplace(state, true).first;
+        hand_ = (hand_ + 1) % ring_.size();
+        ++evictions_;
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of remembered states
+     * @return Stored states, at most the capacity
+     */
+    std::size_t GetSize() const { return states_.size(); }
+
+    /**
+     * @brief Gets the number of states forgotten to make room
+     * @return Evictions so far
+     */
+    uint64_t GetEvictions() const { return evictions_; }
+
+   private:
+    using Map = std::unordered_map<TState, bool, StateHash<TState>>;
+
+    std::size_t capacity_;
+    Map states_;  ///< State -> referenced bit
+    std::vector<typename Map::iterator> ring_;  ///< Clock order of states
+    std::size_t hand_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_VISITED_CACHE_H_
@@ -0,0 +1,200 @@
+/**
+ * @file search_view.h
+ * @brief Incrementally maintained text view of a visual search
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_VISUAL_SEARCH_VIEW_H_
+#define SEARCH_ALG_DATA_STRUCTURE_VISUAL_SEARCH_VIEW_H_
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "problem.h"
+#include "terminal_ui.h"
+#include "visual_node.h"
+
+/**
+ * @brief Tree and frontier panels of a visual search, updated per event
+ *
+ * Replaces rebuilding the whole tree string and frontier listing on every
+ * step: the search reports each node it adds to the tree and each node that
+ * enters or leaves the frontier, and the view only reformats what changed.
+ *
+ * - Tree panel: one row per depth with the node count and the most recent
+ *   node labels that fit the window width. With collapse_closed set, the row
+ *   lists the open nodes instead (frontier nodes and their ancestors) in
+ *   tree order: subtrees without frontier nodes left collapse into the
+ *   count.
+ * - Frontier panel: the frontier nodes ordered by depth, then by generation
+ *   order, each with its state and heuristic. Entries are formatted once,
+ *   by FormatFrontierWindow, and only those that fit the window, so a large
+ *   frontier costs nothing to show.
+ *
+ * Render() builds just the rows that fit the windows and hands them to
+ * TerminalUI::SetWindowLines, which redraws only the rows that differ from
+ * the previous frame, so a step costs O(window size) regardless of the tree
+ * size.
+ *
+ * All methods lock an internal mutex, so a render thread can build frames
+ * while the search thread reports events. The problem is only called from
+ * FormatFrontierWindow, which must run on the thread reporting the events;
+ * building frames only copies strings, so the problem needs no thread
+ * safety.
+ *
+ * @tparam TState The type representing the state of the problem
+ * @tparam TAction The type representing actions that can be taken
+ * @tparam CostType The type used for path costs
+ */
+template <typename TState, typename TAction, typename CostType>
+class SearchView {
+   public:
+    using NodeType = VisualNode<TState, TAction, CostType>;
+
+    /**
+     * @param problem Problem used to format states and heuristics
+     * @param collapse_closed Show only the open nodes in the tree panel
+     * @param max_label_chars Characters of labels shown per depth row
+     */
+    explicit SearchView(const Problem<TState, TAction, CostType>& problem,
+                        bool collapse_closed = false,
+                        std::size_t max_label_chars = 512)
+        : problem_(problem),
+          collapse_closed_(collapse_closed),
+          max_label_chars_(max_label_chars) {}
+
+    /**
+     * @brief Records a node added to the search tree
+     * @param node The new node (root or child)
+     */
+    void AddNode(const NodeType& node);
+
+    /**
+     * @brief Records a node entering the frontier
+     * @param node The node, kept alive by the caller until PopFrontier
+     */
+    void PushFrontier(const NodeType& node);
+
+    /**
+     * @brief Records a node leaving the frontier
+     * @param node The node, previously passed to PushFrontier
+     */
+    void PopFrontier(const NodeType& node);
+
+    /**
+     * @brief Gets the number of nodes added to the tree
+     * @return Node count
+     */
+    uint64_t GetNumNodes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return num_nodes_;
+    }
+
+    /**
+     * @brief Gets the number of nodes in the frontier
+     * @return Frontier size
+     */
+    std::size_t GetFrontierSize() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return frontier_.size();
+    }
+
+    /**
+     * @brief Builds the rows of the tree panel
+     * @param max_rows Rows available
+     * @return Title row followed by one row per depth
+     */
+    std::vector<std::string> GetTreeLines(std::size_t max_rows);
+
+    /**
+     * @brief Formats the first frontier entries not formatted yet, up to
+     * what fits the frontier window
+     *
+     * Calls the problem, so it runs on the thread reporting the events.
+     *
+     * @param max_rows Rows of the frontier window
+     */
+    void FormatFrontierWindow(std::size_t max_rows);
+
+    /**
+     * @brief Builds the rows of the frontier panel
+     * @param max_rows Rows available
+     * @return Title row followed by the first frontier entries that fit, up
+     * to the first one not formatted yet
+     */
+    std::vector<std::string> GetFrontierLines(std::size_t max_rows);
+
+    /**
+     * @brief Draws both panels, redrawing changed rows only
+     * @param ui The terminal UI
+     * @param tree_window Window index of the tree panel
+     * @param frontier_window Window index of the frontier panel
+     */
+    void Render(TerminalUI& ui, int tree_window, int frontier_window);
+
+   private:
+    /**
+     * @brief Nodes of one depth of the tree
+     */
+    struct DepthRow {
+        uint64_t count = 0;                    ///< Nodes at this depth
+        std::deque<std::string> recent;        ///< Latest labels, oldest first
+        std::size_t recent_chars = 0;          ///< Characters in recent
+        std::set<std::vector<uint32_t>> open;  ///< Open nodes' index paths
+        std::string text;                      ///< Formatted row
+        bool dirty = true;                     ///< text is out of date
+    };
+
+    /// Frontier order: depth, then generation order
+    using FrontierKey = std::pair<uint64_t, uint64_t>;
+
+    /**
+     * @brief A frontier node and its panel rows
+     */
+    struct FrontierEntry {
+        const NodeType* node;
+        std::vector<std::string> lines;  ///< Empty until formatted
+    };
+
+    const Problem<TState, TAction, CostType>& problem_;
+    bool collapse_closed_;
+    std::size_t max_label_chars_;
+    uint64_t num_nodes_ = 0;
+    uint64_t num_pushed_ = 0;  ///< Frontier insertions, for ordering
+    mutable std::mutex mutex_;
+
+    std::vector<DepthRow> depth_rows_;
+    std::map<FrontierKey, FrontierEntry> frontier_;
+    std::unordered_map<const NodeType*, FrontierKey> frontier_keys_;
+
+    /// Frontier nodes below each open node, with collapse_closed only
+    std::unordered_map<const NodeType*, uint32_t> open_counts_;
+
+    /**
+     * @brief Formats the panel rows of a frontier node
+     * @param node The node
+     * @return Label, state and heuristic rows, then a blank row
+     */
+    std::vector<std::string> FormatFrontierEntry(const NodeType& node) const;
+
+    /**
+     * @brief Adds a frontier node to the open counts of its ancestors
+     * @param node The node
+     * @param delta +1 when it enters the frontier, -1 when it leaves
+     */
+    void UpdateOpenCounts(const NodeType& node, int delta);
+};
+
+// Include template implementation
+#include "search_view.tpp"
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_VISUAL_SEARCH_VIEW_H_
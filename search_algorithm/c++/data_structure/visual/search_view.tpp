@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "search_view.h"
+
+template <typename TState, typename TAction, typename CostType>
+void SearchView<TState, TAction, CostType>::AddNode(const NodeType& node) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++num_nodes_;
+
+    uint64_t depth = node.GetDepth();
+    if (depth >= depth_rows_.size()) depth_rows_.resize(depth + 1);
+
+    DepthRow& row = depth_rows_[depth];
+    ++row.count;
+    row.dirty = true;
+    if (collapse_closed_) return;
+
+    // Keep only the latest labels that can still be shown
+    row.recent.push_back(node.GetIndexString());
+    row.recent_chars += row.recent.back().size() + 1;
+    while (row.recent.size() > 1 && row.recent_chars > max_label_chars_) {
+        row.recent_chars -= row.recent.front().size() + 1;
+        row.recent.pop_front();
+    }
+}
+
+template <typename TState, typename TAction, typename CostType>
+void SearchView<TState, TAction, CostType>::PushFrontier(const NodeType& node) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    FrontierKey key(node.GetDepth(), num_pushed_++);
+    frontier_keys_[&node] = key;
+    frontier_.emplace(key, FrontierEntry{&node, {}});
+
+    if (collapse_closed_) UpdateOpenCounts(node, +1);
+}
+
+template <typename TState, typename TAction, typename CostType>
+void SearchView<TState, TAction, CostType>::PopFrontier(const NodeType& node) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key = frontier_keys_.find(&node);
+    if (key == frontier_keys_.end()) return;
+
+    frontier_.erase(key->second);
+    frontier_keys_.erase(key);
+
+    if (collapse_closed_) UpdateOpenCounts(node, -1);
+}
+
+template <typename TState, typename TAction, typename CostType>
+void SearchView<TState, TAction, CostType>::FormatFrontierWindow(
+    std::size_t max_rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t rows = 1;  // Title
+    for (auto& [key, entry] : frontier_) {
+        if (rows >= max_rows) break;
+        if (entry.lines.empty()) entry.lines = FormatFrontierEntry(*entry.node);
+        rows += entry.lines.size();
+    }
+}
+
+template <typename TState, typename TAction, typename CostType>
+std::vector<std::string>
+SearchView<TState, TAction, CostType>::FormatFrontierEntry(
+    const NodeType& node) const {
+    std::vector<std::string> lines;
+    lines.push_back(node.GetIndexString() + ":");
+
+    std::istringstream state_lines(problem_.GetStateString(node.GetState()));
+    for (std::string line; std::getline(state_lines, line);)
+        lines.push_back(line);
+
+    CostType heuristic = problem_.Heuristic(node.GetState());
+    if (heuristic != 0)
+        lines.push_back("Heuristic: " + std::to_string(heuristic));
+    lines.push_back("");
+    return lines;
+}
+
+template <typename TState, typename TAction, typename CostType>
+void SearchView<TState, TAction, CostType>::UpdateOpenCounts(
+    const NodeType& node, int delta) {
+    std::vector<uint32_t> index_path = node.GetIndexPath();
+
+    // A node is open while a frontier node is at or below it
+    const NodeType* ancestor = &node;
+    for (std::size_t depth = index_path.size(); depth-- > 0;) {
+        uint32_t& count = open_counts_[ancestor];
+        count += delta;
+        if (count == 0 || (delta > 0 && count == 1)) {
+            DepthRow& row = depth_rows_[depth];
+            std::vector<uint32_t> prefix(index_path.begin(),
+                                         index_path.begin() + depth + 1);
+            if (count == 0) {
+                row.open.erase(prefix);
+                open_counts_.erase(ancestor);
+            } else {
+                row.open.insert(std::move(prefix));
+            }
+            row.dirty = true;
+        }
+        ancestor = static_cast<const NodeType*>(ancestor->GetParent().get());
+    }
+}
+
+template <typename TState, typename TAction, typename CostType>
+std::vector<std::string> SearchView<TState, TAction, CostType>::GetTreeLines(
+    std::size_t max_rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> lines;
+    lines.push_back("Tree (" + std::to_string(num_nodes_) + " nodes):");
+
+    // Deepest rows are the active ones, so they win when space runs out
+    std::size_t rows =
+        std::min(depth_rows_.size(), max_rows > 0 ? max_rows - 1 : 0);
+    for (std::size_t depth = depth_rows_.size() - rows;
+         depth < depth_rows_.size(); ++depth) {
+        DepthRow& row = depth_rows_[depth];
+        if (row.dirty) {
+            std::string text = std::to_string(depth) + " [" +
+                               std::to_string(row.count);
+            if (collapse_closed_) {
+                text += ", " + std::to_string(row.open.size()) + " open]:";
+                for (const auto& index_path : row.open) {
+                    if (text.size() > max_label_chars_) break;
+                    text += " " + NodeType::FormatIndexPath(index_path);
+                }
+            } else {
+                text += "]:";
+                if (row.recent.size() < row.count) text += " ...";
+                for (const std::string& label : row.recent)
+                    text += " " + label;
+            }
+            row.text = std::move(text);
+            row.dirty = false;
+        }
+        lines.push_back(row.text);
+    }
+
+    return lines;
+}
+
+template <typename TState, typename TAction, typename CostType>
+std::vector<std::string>
+SearchView<TState, TAction, CostType>::GetFrontierLines(
+    std::size_t max_rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> lines;
+    lines.push_back("Frontier States (" + std::to_string(frontier_.size()) +
+                    "):");
+
+    for (const auto& [key, entry] : frontier_) {
+        if (lines.size() >= max_rows) break;
+        if (entry.lines.empty()) {
+            lines.push_back("...");  // Formatted at the search's next step
+            break;
+        }
+        for (const std::string& line : entry.lines) {
+            if (lines.size() >= max_rows) return lines;
+            lines.push_back(line);
+        }
+    }
+
+    return lines;
+}
+
+template <typename TState, typename TAction, typename CostType>
+void SearchView<TState, TAction, CostType>::Render(TerminalUI& ui,
+                                                   int tree_window,
+                                                   int frontier_window) {
+    std::size_t rows = ui.GetColumnHeight();
+    ui.SetWindowLines(tree_window, GetTreeLines(rows));
+    ui.SetWindowLines(frontier_window, GetFrontierLines(rows));
+}
@@ -10,6 +10,7 @@
 
 #include <ncurses.h>
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -60,6 +61,7 @@ class TerminalUI {
                 newwin(column_height_, column_width_, 0, i * column_width_),
                 &delwin));
         }
+        window_lines_.resize(columns_);
     }
 
     /**
@@ -100,6 +102,50 @@ class TerminalUI {
         mvwprintw(window_ptr, y, x, "%s", str.c_str());
     }
 
+    /**
+     * @brief Replaces the content of a window, redrawing changed rows only
+     *
+     * Rows are compared with the ones set by the previous call: unchanged
+     * rows are left alone, rows past the end of lines are cleared. Lines are
+     * cut at the window width, so each one takes a single row.
+     *
+     * @param window_index Index of the window (0-based)
+     * @param lines Text of each row, from the top; rows beyond the window
+     * height are ignored
+     */
+    void SetWindowLines(int window_index,
+                        const std::vector<std::string>& lines) {
+        WINDOW* window_ptr = windows_[window_index].get();
+        std::vector<std::string>& shown = window_lines_[window_index];
+
+        std::size_t rows = std::min<std::size_t>(
+            std::max(lines.size(), shown.size()), column_height_);
+        shown.resize(rows);
+        for (std::size_t row = 0; row < rows; ++row) {
+            const std::string& line =
+                row < lines.size() ? lines[row] : std::string();
+            std::string text = line.substr(0, column_width_);
+            if (text == shown[row]) continue;
+
+            mvwaddnstr(window_ptr, row, 0, text.c_str(), text.size());
+            wclrtoeol(window_ptr);
+            shown[row] = std::move(text);
+        }
+        shown.resize(std::min(lines.size(), rows));
+    }
+
+    /**
+     * @brief Gets the number of rows of each column window
+     * @return Window height
+     */
+    uint16_t GetColumnHeight() const { return column_height_; }
+
+    /**
+     * @brief Gets the number of characters per row of each column window
+     * @return Window width
+     */
+    uint16_t GetColumnWidth() const { return column_width_; }
+
     /**
      * @brief Prints text to the status bar at the bottom of the screen
      * @param str String to display in the status bar
@@ -124,6 +170,18 @@ class TerminalUI {
         return getch();  // Use ncurses getch() instead of std::cin
     }
 
+    /**
+     * @brief Gets input from the user, giving up after a timeout
+     * @param timeout_ms Milliseconds to wait for a key
+     * @return Integer representing the key pressed, ERR if none was
+     */
+    int GetInput(int timeout_ms) {
+        timeout(timeout_ms);
+        int ch = getch();
+        timeout(-1);  // Back to blocking reads
+        return ch;
+    }
+
     /**
      * @brief Waits for a specific key to be pressed
      * @param key The key code to wait for
@@ -144,6 +202,8 @@ class TerminalUI {
     uint16_t column_width_,
         column_height_; /**< Dimensions of each individual column */
     std::vector<WindowPtr> windows_; /**< Vector of ncurses window pointers */
+    std::vector<std::vector<std::string>>
+        window_lines_; /**< Rows last drawn by SetWindowLines, per window */
 };
 
 #endif  // SEARCH_ALG_DATA_STRUCTURE_VISUAL_TERMINAL_UI_H_
\ No newline at end of file
@@ -10,7 +10,6 @@
 #define SEARCH_ALG_DATA_STRUCTURE_VISUAL_VISUAL_NODE_H_
 
 #include <cstdint>
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -20,9 +19,12 @@
  * @brief A visual representation of a search tree node that extends the base
  * Node class
  *
- * VisualNode adds visualization capabilities to the standard search node,
- * including the ability to display the search tree structure and maintain
- * hierarchical index strings for easy identification of nodes in the tree.
+ * VisualNode adds the position of the node among its siblings, from which
+ * the hierarchical label of the node ("0.1.2") is formatted on demand by
+ * walking the parent chain. Nodes do not keep their children: the tree is
+ * kept alive by the parent chains of the nodes the search still holds, so
+ * subtrees the search is done with are freed like in the plain searches.
+ * SearchView keeps what is needed to display the tree.
  *
  * @tparam TState The type representing the state of the problem
  * @tparam TAction The type representing actions that can be taken
@@ -40,40 +42,37 @@ class VisualNode : public Node<TState, TAction, CostType> {
     /**
      * @brief Construct a new VisualNode object with full parameters
      *
-     * @param index_string Hierarchical string identifier for this node (e.g.,
-     * "0.1.2")
+     * @param child_index Position of this node among its siblings (0 for the
+     * root)
      * @param state The state this node represents
      * @param parent Shared pointer to the parent VisualNode (nullptr for root)
      * @param action The action taken to reach this state from parent
      * @param path_cost The cumulative cost from root to this node
      */
-    explicit VisualNode(std::string index_string, TState state,
+    explicit VisualNode(uint32_t child_index, TState state,
                         std::shared_ptr<NodeType> parent = nullptr,
                         TAction action = TAction{}, CostType path_cost = 0.0)
         : BaseType(state, parent, action,
                    path_cost),  // This is like super()
-          index_string_(index_string),
-          children_() {}
+          child_index_(child_index) {}
 
     /**
      * @brief Construct a VisualNode from an existing base Node
      *
-     * @param node Shared pointer to an existing Node to convert
-     * @param index_string Hierarchical string identifier for this visual node
+     * @param node Shared pointer to an existing Node to convert, whose parent
+     * is a VisualNode
+     * @param child_index Position of this node among its siblings
      */
-    explicit VisualNode(std::shared_ptr<BaseType> node,
-                        std::string index_string)
+    explicit VisualNode(std::shared_ptr<BaseType> node, uint32_t child_index)
         : BaseType(node->GetState(), node->GetParent(), node->GetAction(),
                    node->GetPathCost()),
-          index_string_(index_string),
-          children_() {}
+          child_index_(child_index) {}
 
     /**
      * @brief Expand this node by generating all possible successor states
      *
      * Creates child VisualNode objects for each action available from the
-     * current state. Each child is assigned a hierarchical index string based
-     * on its position.
+     * current state, numbered by their position.
      *
      * @param problem The problem instance providing actions and state
      * transitions
@@ -84,72 +83,40 @@ class VisualNode : public Node<TState, TAction, CostType> {
         Problem<TState, TAction, CostType>& problem);
 
     /**
-     * @brief Get the hierarchical index string for this node
-     *
-     * @return const std::string& Reference to the index string (e.g., "0.1.2")
+     * @brief Get the position of this node among its siblings
+     * @return uint32_t Child index, 0 for the root
      */
-    const std::string& GetIndexString() const { return index_string_; }
+    uint32_t GetChildIndex() const { return child_index_; }
 
     /**
-     * @brief Get the children of this node
-     *
-     * @warning If this method is called before Expand(), it will return an
-     * empty vector.
-     * @return const std::vector<std::shared_ptr<VisualNode<TState, TAction,
-     * CostType>>>& Reference to the vector of child nodes
+     * @brief Get the child indices from the root down to this node
+     * @return std::vector<uint32_t> One index per depth, root first
      */
-    const std::vector<std::shared_ptr<VisualNode<TState, TAction, CostType>>>&
-    GetChildren() const {
-        return children_;
-    }
-
-    std::string GetTreeString() const;
+    std::vector<uint32_t> GetIndexPath() const;
 
     /**
-     * @brief Print the entire search tree starting from the root
+     * @brief Format the hierarchical label of this node
      *
-     * Displays the tree structure level by level, showing the hierarchical
-     * index strings for each node.
-     * Assumes that the node that called this method is the root.
+     * Walks the parent chain, so it costs O(depth); meant for the nodes
+     * being displayed.
      *
-     * Output format:
-     * - Depth 0: [root index]
-     * - Depth 1: [child1 index] [child2 index] ...
-     * - Depth 2: [grandchild indices] ...
+     * @return std::string Label such as "0.1.2" (root's second child's third
+     * child)
      */
-    void PrintTree() const;
-
-    std::queue<std::shared_ptr<VisualNode<TState, TAction, CostType>>>
-    GetFrontierStates(const Problem<TState, TAction, CostType>& problem) const;
-
-    // Get the frontier states and format them as a string
-    std::string GetFrontierStatesString(
-        const Problem<TState, TAction, CostType>& problem) const;
+    std::string GetIndexString() const;
 
-    // Given the frontier states, format according to the problem
-    std::string FormatFrontierStates(
-        std::queue<std::shared_ptr<VisualNode<TState, TAction, CostType>>>
-            frontier,
-        const Problem<TState, TAction, CostType>& problem) const;
-
-   private:
     /**
-     * @brief Hierarchical index string for node identification
-     *
-     * Format: "x.y.z" where each number represents the position at each depth
-     * level. Example: "0.1.2" means root's second child's third child.
+     * @brief Format a label from child indices
+     * @param index_path Child indices, root first
+     * @return std::string Indices joined with '.'
      */
-    std::string index_string_;
+    static std::string FormatIndexPath(const std::vector<uint32_t>& index_path);
 
+   private:
     /**
-     * @brief Vector of child VisualNode pointers
-     *
-     * Populated when Expand() is called. Empty vector indicates either:
-     * 1. Node has not been expanded yet, or
-     * 2. Node is a leaf with no valid actions
+     * @brief Position of this node among its siblings
      */
-    std::vector<std::shared_ptr<VisualNode<TState, TAction, CostType>>>
-        children_;
+    uint32_t child_index_;
 };
 
 // Include template implementation
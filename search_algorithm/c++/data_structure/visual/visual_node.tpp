@@ -1,7 +1,3 @@
-#include <ncurses.h>
-
-#include <queue>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -18,134 +14,43 @@ VisualNode<TState, TAction, CostType>::Expand(
     // Convert base class nodes to VisualNode
     std::vector<std::shared_ptr<VisualNode<TState, TAction, CostType>>>
         children;
-    for (size_t i = 0; i < base_children.size(); ++i) {
-        std::string index_str = this->index_string_ + '.' + std::to_string(i);
+    children.reserve(base_children.size());
+    for (size_t i = 0; i < base_children.size(); ++i)
         children.push_back(
             std::make_shared<VisualNode<TState, TAction, CostType>>(
-                base_children[i], index_str));
-    }
+                base_children[i], static_cast<uint32_t>(i)));
 
-    this->children_ = std::move(children);
-
-    return this->children_;
+    return children;
 }
 
 template <typename TState, typename TAction, typename CostType>
-std::string VisualNode<TState, TAction, CostType>::GetTreeString() const {
-    std::stringstream tree_ss;
-
-    std::queue<std::shared_ptr<NodeType>> node_queue;
-    node_queue.push(
-        std::make_shared<VisualNode<TState, TAction, CostType>>(*this));
-
-    uint64_t depth = this->GetDepth();
-
-    while (!node_queue.empty()) {
-        uint64_t this_depth_node_count = node_queue.size();
-
-        // Get depth level
-        tree_ss << std::to_string(depth) << ": ";
-
-        // Process all nodes at the current depth
-        for (uint64_t i = 0; i < this_depth_node_count; ++i) {
-            std::shared_ptr<NodeType> current_node = node_queue.front();
-            node_queue.pop();
-            tree_ss << current_node->index_string_ << " ";
-
-            // Enqueue children for the next depth level
-            for (const auto& child : current_node->children_)
-                node_queue.push(child);
-        }
-        tree_ss << std::endl;
-
-        depth++;
+std::vector<uint32_t> VisualNode<TState, TAction, CostType>::GetIndexPath()
+    const {
+    std::vector<uint32_t> index_path(this->GetDepth() + 1);
+
+    // Parents of visual nodes are visual nodes, see Expand()
+    const NodeType* node = this;
+    for (auto index = index_path.rbegin(); index != index_path.rend();
+         ++index) {
+        *index = node->child_index_;
+        node = static_cast<const NodeType*>(node->GetParent().get());
     }
 
-    return tree_ss.str();
+    return index_path;
 }
 
 template <typename TState, typename TAction, typename CostType>
-void VisualNode<TState, TAction, CostType>::PrintTree() const {
-    std::queue<std::shared_ptr<NodeType>> node_queue;
-    node_queue.push(
-        std::make_shared<VisualNode<TState, TAction, CostType>>(*this));
-
-    uint64_t depth = this->GetDepth();
-
-    while (!node_queue.empty()) {
-        uint64_t this_depth_node_count = node_queue.size();
-
-        // Print depth level
-        std::cout << std::to_string(depth) << ": ";
-
-        // Process all nodes at the current depth
-        for (uint64_t i = 0; i < this_depth_node_count; ++i) {
-            std::shared_ptr<NodeType> current_node = node_queue.front();
-            node_queue.pop();
-            std::cout << current_node->index_string_ << " ";
-
-            // Enqueue children for the next depth level
-            for (const auto& child : current_node->children_)
-                node_queue.push(child);
-        }
-        std::cout << std::endl;
-
-        depth++;
-    }
+std::string VisualNode<TState, TAction, CostType>::GetIndexString() const {
+    return FormatIndexPath(GetIndexPath());
 }
 
 template <typename TState, typename TAction, typename CostType>
-std::queue<std::shared_ptr<VisualNode<TState, TAction, CostType>>>
-VisualNode<TState, TAction, CostType>::GetFrontierStates(
-    const Problem<TState, TAction, CostType>& problem) const {
-    std::queue<std::shared_ptr<NodeType>> node_queue;
-    node_queue.push(
-        std::make_shared<VisualNode<TState, TAction, CostType>>(*this));
-
-    std::queue<std::shared_ptr<NodeType>> frontier;
-
-    while (!node_queue.empty()) {
-        std::shared_ptr<NodeType> current_node = node_queue.front();
-        node_queue.pop();
-
-        if (current_node->children_.empty()) {
-            frontier.push(current_node);
-        } else {
-            for (const auto& child : current_node->children_)
-                node_queue.push(child);
-        }
+std::string VisualNode<TState, TAction, CostType>::FormatIndexPath(
+    const std::vector<uint32_t>& index_path) {
+    std::string label;
+    for (uint32_t index : index_path) {
+        if (!label.empty()) label += '.';
+        label += std::to_string(index);
     }
-
-    return frontier;
+    return label;
 }
-
-template <typename TState, typename TAction, typename CostType>
-std::string VisualNode<TState, TAction, CostType>::FormatFrontierStates(
-    std::queue<std::shared_ptr<VisualNode<TState, TAction, CostType>>> frontier,
-    const Problem<TState, TAction, CostType>& problem) const {
-    std::stringstream frontier_states_ss;
-
-    // Format the frontier states into a string
-    while (!frontier.empty()) {
-        std::shared_ptr<NodeType> node = frontier.front();
-        frontier.pop();
-        frontier_states_ss << node->index_string_ << ":\n"
-                           << problem.GetStateString(node->GetState()) << "\n";
-        if (problem.Heuristic(node->GetState()) != 0)
-            frontier_states_ss
-                << "Heuristic: "
-                << std::to_string(problem.Heuristic(node->GetState())) << "\n";
-    }
-
-    return frontier_states_ss.str();
-}
-
-template <typename TState, typename TAction, typename CostType>
-std::string VisualNode<TState, TAction, CostType>::GetFrontierStatesString(
-    const Problem<TState, TAction, CostType>& problem) const {
-    std::stringstream frontier_states_ss;
-
-    std::queue<std::shared_ptr<NodeType>> frontier = GetFrontierStates(problem);
-
-    return FormatFrontierStates(frontier, problem);
-}
\ No newline at end of file
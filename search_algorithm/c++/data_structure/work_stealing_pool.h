@@ -0,0 +1,216 @@
+/**
+ * @file work_stealing_pool.h
+ * @brief Thread pool with one task deque per worker and work stealing
+ * @author Andre Grassi
+ * @date 2025
+ */
+
+#ifndef SEARCH_ALG_DATA_STRUCTURE_WORK_STEALING_POOL_H_
+#define SEARCH_ALG_DATA_STRUCTURE_WORK_STEALING_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Fixed set of worker threads running submitted tasks
+ *
+ * Every worker owns a deque. Tasks submitted from a worker go to the back of
+ * its own deque and the worker takes tasks from the back (newest first), so
+ * the subtasks of a task run close to it. A worker with an empty deque
+ * steals from the front (oldest first) of the others, which takes the
+ * largest pieces of work in divide-and-conquer uses. Tasks submitted from
+ * outside the pool are spread over the deques in turn.
+ *
+ * Tasks may submit further tasks. Wait() returns once every task, including
+ * those, has finished.
+ *
+ * HasIdleWorkers() tells a long task whether splitting off part of its work
+ * would keep another worker busy.
+ */
+class WorkStealingPool {
+   public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Starts the workers
+     * @param num_threads Number of workers, 0 for one per hardware thread
+     */
+    explicit WorkStealingPool(std::size_t num_threads = 0) {
+        if (num_threads == 0)
+            num_threads = std::max(1u, std::thread::hardware_concurrency());
+        queues_.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i)
+            queues_.push_back(std::make_unique<Queue>());
+        idle_ = num_threads;
+        threads_.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i)
+            threads_.emplace_back([this, i]() { RunWorker(i); });
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Stops the workers once the queued tasks are done
+     */
+    ~WorkStealingPool() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            all_done_.wait(lock, [this]() { return pending_ == 0; });
+            stopping_ = true;
+        }
+        work_available_.notify_all();
+        for (std::thread& thread : threads_) thread.join();
+    }
+
+    /**
+     * @brief Queues a task
+     * @param task The task; may itself call Submit
+     */
+    void Submit(Task task) {
+        std::size_t index = current_pool_ == this
+                                ? current_index_
+                                : next_queue_++ % queues_.size();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++pending_;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++queued_;
+        }
+        work_available_.notify_one();
+    }
+
+    /**
+     * @brief Blocks until every submitted task has finished
+     * @throws The first exception a task threw since the last Wait
+     */
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        all_done_.wait(lock, [this]() { return pending_ == 0; });
+        if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+
+    /**
+     * @brief Tells whether a worker is waiting for a task not yet queued
+     * @return true if idle workers outnumber the queued tasks
+     */
+    bool HasIdleWorkers() const {
+        return idle_.load(std::memory_order_relaxed) >
+               queued_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the number of workers
+     * @return Worker count
+     */
+    std::size_t GetNumThreads() const { return threads_.size(); }
+
+   private:
+    /**
+     * @brief Task deque of one worker
+     */
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<std::size_t> next_queue_{0};
+
+    /// Guards pending_, queued_ changes, error_ and stopping_ for the
+    /// condition variables; idle_ and queued_ are atomic for lock-free reads
+    std::mutex mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable all_done_;
+    std::size_t pending_ = 0;  ///< Tasks submitted and not finished
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<std::size_t> idle_{0};
+    std::exception_ptr error_;
+    bool stopping_ = false;
+
+    /// Pool and index of the worker running on this thread, if any
+    inline static thread_local WorkStealingPool* current_pool_ = nullptr;
+    inline static thread_local std::size_t current_index_ = 0;
+
+    /**
+     * @brief Takes a task, from the back of the worker's own deque or the
+     * front of another one
+     * @param index Index of the worker
+     * @param out_task Output: the task
+     * @return true if a task was taken
+     */
+    bool TakeTask(std::size_t index, Task* out_task) {
+        for (std::size_t i = 0; i < queues_.size(); ++i) {
+            Queue& queue = *queues_[(index + i) % queues_.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) continue;
+            if (i == 0) {
+                *out_task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                *out_task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Main loop of a worker thread
+     * @param index Index of the worker
+     */
+    void RunWorker(std::size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_available_.wait(
+                    lock, [this]() { return queued_ > 0 || stopping_; });
+                if (queued_ == 0) return;  // Stopping
+                // Claim a task before looking for it, so the claims never
+                // exceed the queued tasks
+                --queued_;
+                --idle_;
+            }
+
+            // Tasks are pushed before they are counted, so one is there, but
+            // another worker may take it first and leave a later one
+            Task task;
+            while (!TakeTask(index, &task)) std::this_thread::yield();
+
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++idle_;
+            if (--pending_ == 0) all_done_.notify_all();
+        }
+    }
+};
+
+#endif  // SEARCH_ALG_DATA_STRUCTURE_WORK_STEALING_POOL_H_
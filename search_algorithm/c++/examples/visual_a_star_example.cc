@@ -20,7 +20,20 @@ int main() {
 
     uint64_t dimension;
     std::cout << "Enter board dimension (e.g., 3 for 3x3): ";
-    std::cin >> dimension;
+    if (!(std::cin >> dimension) || dimension < 2) {
+        std::cerr << "Invalid board dimension" << std::endl;
+        return 2;
+    }
+
+    int playback;
+    std::cout << "Playback (0 = step, 1 = auto-play, 2 = headless): ";
+    if (!(std::cin >> playback) || playback < 0 || playback > 2) {
+        std::cerr << "Invalid playback mode, expected 0, 1 or 2" << std::endl;
+        return 2;
+    }
+
+    visual_search::VisualOptions options;
+    options.playback = static_cast<visual_search::PlaybackMode>(playback);
 
     // Create a sliding tile problem
     auto problem =
@@ -37,8 +50,12 @@ int main() {
 
     std::shared_ptr<NodeType> solution =
         visual_search::VisualBestFirstSearch<TState, TAction, TCost,
-                                             Comparator>(*problem);
+                                             Comparator>(*problem, options);
 
+    if (!solution) {
+        std::cout << "No solution found" << std::endl;
+        return 1;
+    }
     problem->PrintState(solution->GetState());
 
     return 0;
@@ -0,0 +1,588 @@
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "algorithms/search_algorithm.h"
+#include "data_structure/fingerprint_set.h"
+#include "data_structure/node_comparator.h"
+#include "data_structure/problems/chess_board_problem.h"
+#include "data_structure/problems/fixed_sliding_tile_problem.h"
+#include "data_structure/problems/sliding_tile_generator.h"
+#include "data_structure/work_stealing_pool.h"
+
+// Long-lived solver listening on a Unix domain socket, so that queries do
+// not pay for process startup and problem precomputation every time. The
+// chess presets (Zobrist keys, goal distance tables) are built once at
+// startup. The main thread reads the requests of every connection, and
+// each request line is solved as one task on a pool of worker threads, so
+// idle clients hold no worker. Solved instances are cached by state
+// fingerprint.
+//
+// Line protocol, one request per line, one reply line per request, in
+// request order:
+//
+//   tile <dimension> <tiles row by row> [<max expansions>]
+//   chess <preset> [<max expansions>]
+//   stats
+//
+// Replies:
+//
+//   ok <cost> <expanded> <solved|cached> <moves...>
+//   none <expanded>      no solution exists
+//   budget <expanded>    gave up after the expansion budget
+//   stats requests <n> hits <n> misses <n> entries <n>
+//   error <message>
+//
+// Tile moves are the blank's U, D, L or R; chess moves are written as
+// <piece><from row>,<from col>-<to row>,<to col>. Tiles use A* on
+// FixedSlidingTileProblem (dimensions 3 to 5), chess uses A* on the preset.
+// A request's budget is capped by --max-expansions, which must be positive
+// so that every search ends and the daemon can stop.
+//
+// Usage: solver_daemon <socket path> [--threads <n>] [--cache <entries>]
+//                      [--max-expansions <n>]
+//
+// Try it with: echo "chess 2" | nc -U <socket path>
+
+namespace {
+
+constexpr std::size_t kMaxLineBytes = 1 << 16;
+
+/// A client that reads no replies for this long is disconnected
+constexpr int kSendTimeoutSeconds = 10;
+
+std::atomic<bool> stopping{false};
+
+void OnSignal(int) { stopping = true; }
+
+/**
+ * @brief Bounded map from instance fingerprints to replies
+ *
+ * Entries keep the instance text, so a fingerprint collision is a miss
+ * rather than a wrong answer. The oldest entry is dropped when full.
+ */
+class ResultCache {
+   public:
+    explicit ResultCache(std::size_t capacity) : capacity_(capacity) {}
+
+    bool Find(uint64_t key, const std::string& instance, std::string* reply) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = entries_.find(key);
+        if (found == entries_.end() || found->second.instance != instance) {
+            ++misses_;
+            return false;
+        }
+        ++hits_;
+        *reply = found->second.reply;
+        return true;
+    }
+
+    void Insert(uint64_t key, std::string instance, std::string reply) {
+        if (capacity_ == 0) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto [it, inserted] = entries_.try_emplace(key);
+        it->second = Entry{std::move(instance), std::move(reply)};
+        if (!inserted) return;  // Keeps its place in the eviction order
+        order_.push_back(key);
+        if (order_.size() > capacity_) {
+            entries_.erase(order_.front());
+            order_.pop_front();
+        }
+    }
+
+    std::string Describe() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::ostringstream out;
+        out << "hits " << hits_ << " misses " << misses_ << " entries "
+            << entries_.size();
+        return out.str();
+    }
+
+   private:
+    struct Entry {
+        std::string instance;  ///< Normalized request, without the budget
+        std::string reply;
+    };
+
+    std::size_t capacity_;
+    std::mutex mutex_;
+    std::unordered_map<uint64_t, Entry> entries_;
+    std::deque<uint64_t> order_;  ///< Keys, oldest first
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+/**
+ * @brief Formats the reply of a finished search
+ * @param solution Goal node, nullptr if the search failed
+ * @param statistics Counters of the search
+ * @param budget Expansion budget the search ran with
+ * @param move Writes the action of a node to the stream
+ */
+template <typename NodeType, typename WriteMove>
+std::string FormatReply(const std::shared_ptr<NodeType>& solution,
+                        const search_algorithm::SearchStatistics& statistics,
+                        uint64_t budget, WriteMove move) {
+    std::ostringstream out;
+    if (!solution) {
+        bool out_of_budget = budget > 0 && statistics.expanded >= budget;
+        out << (out_of_budget ? "budget " : "none ") << statistics.expanded;
+        return out.str();
+    }
+
+    std::vector<const NodeType*> path;
+    for (const NodeType* node = solution.get(); node && node->GetParent();
+         node = node->GetParent().get())
+        path.push_back(node);
+
+    out << "ok " << solution->GetPathCost() << " " << statistics.expanded
+        << " solved";
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        out << " ";
+        move(out, (*it)->GetAction());
+    }
+    return out.str();
+}
+
+class Solver {
+   public:
+    Solver(std::size_t cache_entries, uint64_t max_expansions)
+        : cache_(cache_entries), max_expansions_(max_expansions) {
+        for (int preset : {1, 2})
+            chess_[preset] =
+                std::make_unique<chess_board::ChessBoardProblem>(preset);
+    }
+
+    /**
+     * @brief Answers one request line
+     * @param line The request, without its newline
+     * @return The reply, without its newline
+     */
+    std::string Handle(const std::string& line) {
+        ++requests_;
+        std::istringstream in(line);
+        std::string kind;
+        in >> kind;
+        try {
+            if (kind == "tile") return HandleTile(in);
+            if (kind == "chess") return HandleChess(in);
+            if (kind == "stats") {
+                std::ostringstream out;
+                out << "stats requests " << requests_ << " "
+                    << cache_.Describe();
+                return out.str();
+            }
+            return "error unknown request '" + kind + "'";
+        } catch (const std::exception& error) {
+            return std::string("error ") + error.what();
+        }
+    }
+
+   private:
+    ResultCache cache_;
+    uint64_t max_expansions_;
+    std::atomic<uint64_t> requests_{0};
+    /// Built at startup and only read afterwards, so workers share them
+    std::map<int, std::unique_ptr<const chess_board::ChessBoardProblem>>
+        chess_;
+
+    /**
+     * @brief Reads the optional budget at the end of a request
+     * @return Requested budget capped by max_expansions_
+     */
+    uint64_t ReadBudget(std::istringstream& in) const {
+        uint64_t budget = max_expansions_;
+        std::string token;
+        if (in >> token) {
+            if (token.find_first_not_of("0123456789") != std::string::npos ||
+                token.size() > 19)
+                throw std::invalid_argument("bad budget '" + token + "'");
+            uint64_t requested = std::stoull(token);
+            if (requested > 0 && requested < budget) budget = requested;
+        }
+        if (in >> token)
+            throw std::invalid_argument("unexpected '" + token + "'");
+        return budget;
+    }
+
+    /**
+     * @brief Looks an instance up in the cache, solving it on a miss
+     * @param key Fingerprint of the instance's state
+     * @param instance Normalized request text, without the budget
+     * @param solve Runs the search and returns its reply
+     */
+    template <typename Solve>
+    std::string Cached(uint64_t key, std::string instance, Solve solve) {
+        std::string reply;
+        if (cache_.Find(key, instance, &reply)) {
+            // "ok <cost> <expanded> solved ..." is stored
+            std::size_t tag = reply.find(" solved");
+            if (tag != std::string::npos) reply.replace(tag, 7, " cached");
+            return reply;
+        }
+        reply = solve();
+        // A budget failure may succeed with a larger budget next time
+        if (reply.compare(0, 7, "budget ") != 0)
+            cache_.Insert(key, std::move(instance), reply);
+        return reply;
+    }
+
+    std::string HandleTile(std::istringstream& in) {
+        uint64_t dimension = 0;
+        if (!(in >> dimension) || dimension < 3 || dimension > 5)
+            throw std::invalid_argument("tile dimension must be 3, 4 or 5");
+
+        sliding_tile::State board(dimension,
+                                  std::vector<uint64_t>(dimension));
+        std::vector<bool> seen(dimension * dimension, false);
+        std::ostringstream instance;
+        instance << "tile " << dimension;
+        for (auto& row : board) {
+            for (uint64_t& tile : row) {
+                if (!(in >> tile) || tile >= seen.size() || seen[tile])
+                    throw std::invalid_argument(
+                        "tiles must hold 0 to dimension^2 - 1 once each");
+                seen[tile] = true;
+                instance << " " << tile;
+            }
+        }
+        uint64_t budget = ReadBudget(in);
+
+        return Cached(FingerprintSet::Fingerprint(board), instance.str(),
+                      [&]() -> std::string {
+                          if (!sliding_tile::IsSolvable(board))
+                              return "none 0";
+                          switch (dimension) {
+                              case 3:
+                                  return SolveTile<3>(board, budget);
+                              case 4:
+                                  return SolveTile<4>(board, budget);
+                              default:
+                                  return SolveTile<5>(board, budget);
+                          }
+                      });
+    }
+
+    template <uint64_t N>
+    static std::string SolveTile(const sliding_tile::State& board,
+                                 uint64_t budget) {
+        using Puzzle = sliding_tile::FixedSlidingTileProblem<N>;
+        using Comparator = CompareByAStar<typename Puzzle::StateType,
+                                          sliding_tile::Action,
+                                          sliding_tile::CostType, Puzzle>;
+
+        Puzzle puzzle(board);
+        search_algorithm::SearchStatistics statistics;
+        search_algorithm::SearchOptions options;
+        options.statistics = &statistics;
+        options.max_expansions = budget;
+        auto solution = search_algorithm::BestFirstSearch<
+            typename Puzzle::StateType, sliding_tile::Action,
+            sliding_tile::CostType, Comparator>(puzzle, options);
+
+        return FormatReply(solution, statistics, budget,
+                           [](std::ostream& out, sliding_tile::Action move) {
+                               static const char kNames[] = "UDLR";
+                               out << kNames[static_cast<int>(move)];
+                           });
+    }
+
+    std::string HandleChess(std::istringstream& in) {
+        int preset = 0;
+        if (!(in >> preset) || chess_.count(preset) == 0)
+            throw std::invalid_argument("chess preset must be 1 or 2");
+        uint64_t budget = ReadBudget(in);
+        const chess_board::ChessBoardProblem& problem = *chess_.at(preset);
+
+        return Cached(
+            FingerprintSet::Fingerprint(problem.GetInitialState()),
+            "chess " + std::to_string(preset), [&]() {
+                using Comparator =
+                    CompareByAStar<chess_board::State, chess_board::Action,
+                                   chess_board::ChessCostType,
+                                   chess_board::ChessBoardProblem>;
+
+                search_algorithm::SearchStatistics statistics;
+                search_algorithm::SearchOptions options;
+                options.statistics = &statistics;
+                options.max_expansions = budget;
+                auto solution = search_algorithm::BestFirstSearch<
+                    chess_board::State, chess_board::Action,
+                    chess_board::ChessCostType, Comparator>(problem, options);
+
+                return FormatReply(
+                    solution, statistics, budget,
+                    [](std::ostream& out, const chess_board::Action& move) {
+                        out << static_cast<char>(move.piece) << move.fromRow
+                            << "," << move.fromCol << "-" << move.toRow << ","
+                            << move.toCol;
+                    });
+            });
+    }
+};
+
+bool WriteAll(int fd, const std::string& data) {
+    std::size_t written = 0;
+    while (written < data.size()) {
+        ssize_t count = send(fd, data.data() + written, data.size() - written,
+                             MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR) continue;
+        if (count <= 0) return false;
+        written += static_cast<std::size_t>(count);
+    }
+    return true;
+}
+
+/**
+ * @brief A client socket, closed when the reading loop and every task of
+ * the client are done with it
+ *
+ * Requests are numbered as they are read and may be solved concurrently;
+ * replies are written in request order by whichever task completes the
+ * next one.
+ */
+class Connection {
+   public:
+    explicit Connection(int fd) : fd_(fd) {}
+    ~Connection() { close(fd_); }
+
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    int GetFd() const { return fd_; }
+
+    /**
+     * @brief Numbers the next request; called by the reading loop only
+     */
+    uint64_t NextRequest() { return next_request_++; }
+
+    /**
+     * @brief Writes a reply, once the replies to earlier requests are out
+     * @param request Number of the request, from NextRequest
+     * @param reply The reply, without its newline
+     */
+    void Reply(uint64_t request, std::string reply) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.emplace(request, std::move(reply));
+        for (auto it = ready_.begin();
+             it != ready_.end() && it->first == next_reply_;
+             it = ready_.erase(it), ++next_reply_) {
+            if (!broken_) broken_ = !WriteAll(fd_, it->second + "\n");
+        }
+    }
+
+    /**
+     * @brief Makes pending and future reads and writes fail
+     */
+    void Shutdown() { shutdown(fd_, SHUT_RDWR); }
+
+   private:
+    int fd_;
+    uint64_t next_request_ = 0;
+    std::mutex mutex_;
+    uint64_t next_reply_ = 0;                ///< Next request to answer
+    std::map<uint64_t, std::string> ready_;  ///< Replies waiting their turn
+    bool broken_ = false;                    ///< A write failed
+};
+
+/**
+ * @brief A connection being read, with its incomplete request line
+ */
+struct Client {
+    std::shared_ptr<Connection> connection;
+    std::string buffer;
+};
+
+/**
+ * @brief Reads what a client sent and submits a task per complete line
+ * @return false once the client is done sending: it closed its end, the
+ * read failed or the line was too long
+ */
+bool ReadRequests(Client* client, Solver* solver, WorkStealingPool* pool) {
+    char chunk[4096];
+    ssize_t count = read(client->connection->GetFd(), chunk, sizeof(chunk));
+    if (count < 0 && errno == EINTR) return true;
+    if (count <= 0) return false;
+    client->buffer.append(chunk, static_cast<std::size_t>(count));
+
+    std::shared_ptr<Connection> connection = client->connection;
+    std::size_t start = 0, newline;
+    while ((newline = client->buffer.find('\n', start)) != std::string::npos) {
+        std::string line = client->buffer.substr(start, newline - start);
+        start = newline + 1;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+        uint64_t request = connection->NextRequest();
+        pool->Submit([connection, request, line = std::move(line), solver]() {
+            connection->Reply(request, stopping ? "error daemon stopping"
+                                                : solver->Handle(line));
+        });
+    }
+    client->buffer.erase(0, start);
+
+    if (client->buffer.size() > kMaxLineBytes) {
+        uint64_t request = connection->NextRequest();
+        pool->Submit([connection, request]() {
+            connection->Reply(request, "error request line too long");
+        });
+        return false;
+    }
+    return true;
+}
+
+int Listen(const std::string& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+        throw std::invalid_argument("socket path too long");
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) throw std::runtime_error(std::strerror(errno));
+    unlink(path.c_str());  // Left behind by a daemon that did not stop cleanly
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        listen(fd, SOMAXCONN) < 0) {
+        std::string message = std::strerror(errno);
+        close(fd);
+        throw std::runtime_error(path + ": " + message);
+    }
+    return fd;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t num_threads = 0;
+    std::size_t cache_entries = 100000;
+    uint64_t max_expansions = 5000000;
+
+    bool usage_error = argc < 2;
+    for (int i = 2; i < argc && !usage_error; i += 2) {
+        std::string flag = argv[i];
+        if (i + 1 >= argc) {
+            usage_error = true;
+            break;
+        }
+        try {
+            uint64_t value = std::stoull(argv[i + 1]);
+            if (flag == "--threads")
+                num_threads = value;
+            else if (flag == "--cache")
+                cache_entries = value;
+            else if (flag == "--max-expansions")
+                max_expansions = value;
+            else
+                usage_error = true;
+        } catch (const std::exception&) {
+            usage_error = true;
+        }
+    }
+    if (usage_error) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <socket path> [--threads <n>] [--cache <entries>]"
+                     " [--max-expansions <n>]"
+                  << std::endl;
+        return 2;
+    }
+    if (max_expansions == 0) {
+        std::cerr << "Error: --max-expansions must be positive" << std::endl;
+        return 2;
+    }
+    const std::string path = argv[1];
+
+    // The stop signals stay blocked except inside ppoll(), so one that
+    // arrives while the loop is busy is delivered at the next ppoll() and
+    // cannot be lost. Worker threads inherit the blocked mask.
+    sigset_t stop_signals, poll_mask;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, &poll_mask);
+    sigdelset(&poll_mask, SIGINT);
+    sigdelset(&poll_mask, SIGTERM);
+    struct sigaction action {};
+    action.sa_handler = OnSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    int listen_fd;
+    try {
+        listen_fd = Listen(path);
+    } catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << std::endl;
+        return 1;
+    }
+
+    Solver solver(cache_entries, max_expansions);
+    std::map<int, Client> clients;
+    {
+        WorkStealingPool pool(num_threads);
+        std::cerr << "Listening on " << path << " with "
+                  << pool.GetNumThreads() << " workers" << std::endl;
+
+        std::vector<pollfd> poll_fds;
+        while (!stopping) {
+            poll_fds.assign(1, pollfd{listen_fd, POLLIN, 0});
+            for (const auto& [fd, client] : clients)
+                poll_fds.push_back(pollfd{fd, POLLIN, 0});
+            if (ppoll(poll_fds.data(), poll_fds.size(), nullptr, &poll_mask) <
+                0) {
+                if (errno == EINTR) continue;
+                std::cerr << "Error: ppoll: " << std::strerror(errno)
+                          << std::endl;
+                break;
+            }
+
+            for (std::size_t i = 1; i < poll_fds.size(); ++i) {
+                if (poll_fds[i].revents == 0) continue;
+                auto it = clients.find(poll_fds[i].fd);
+                // Tasks still holding the connection close it when done
+                if (!ReadRequests(&it->second, &solver, &pool))
+                    clients.erase(it);
+            }
+
+            if (poll_fds[0].revents & POLLIN) {
+                int fd = accept(listen_fd, nullptr, nullptr);
+                if (fd < 0) {
+                    if (errno == EINTR || errno == ECONNABORTED) continue;
+                    std::cerr << "Error: accept: " << std::strerror(errno)
+                              << std::endl;
+                    break;
+                }
+                timeval timeout{kSendTimeoutSeconds, 0};
+                setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout,
+                           sizeof(timeout));
+                clients[fd].connection = std::make_shared<Connection>(fd);
+            }
+        }
+
+        // Queued requests are answered with an error; running searches
+        // finish first, within their expansion budget
+        for (auto& [fd, client] : clients) client.connection->Shutdown();
+        clients.clear();
+    }
+
+    close(listen_fd);
+    unlink(path.c_str());
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structure/search_trace.h"
+
+// Summarizes a binary search trace written through SearchOptions::trace:
+// event counts, duplicate rate, expansions per depth and per f = g + h layer.
+// Streams the file block by block; memory grows with the number of distinct
+// depths and f values, and by 4 bytes per node for the heuristic values,
+// which only a node's first record carries.
+//
+// Usage: trace_report <trace file>
+
+namespace {
+
+struct Layer {
+    uint64_t expanded = 0;
+    uint64_t generated = 0;
+    uint64_t duplicates = 0;
+};
+
+template <typename Key>
+void PrintLayers(const char* title, const std::map<Key, Layer>& layers) {
+    std::cout << std::endl
+              << std::setw(10) << title << std::setw(14) << "expanded"
+              << std::setw(14) << "generated" << std::setw(14) << "duplicates"
+              << std::endl;
+    for (const auto& [key, layer] : layers)
+        std::cout << std::setw(10) << key << std::setw(14) << layer.expanded
+                  << std::setw(14) << layer.generated << std::setw(14)
+                  << layer.duplicates << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <trace file>" << std::endl;
+        return 2;
+    }
+
+    uint64_t counts[5] = {0, 0, 0, 0, 0};
+    uint64_t records = 0;
+    std::map<uint32_t, Layer> by_depth;
+    std::map<float, Layer> by_f;
+    std::vector<float> h_by_id;  // Node ids count up from 1
+
+    try {
+        TraceReader reader(argv[1]);
+        std::vector<TraceRecord> block;
+        while (reader.ReadBlock(&block)) {
+            for (const TraceRecord& record : block) {
+                ++records;
+                auto event = static_cast<std::size_t>(record.event);
+                if (event < 5) ++counts[event];
+
+                if (!std::isnan(record.h)) {
+                    if (record.node_id >= h_by_id.size())
+                        h_by_id.resize(record.node_id + 1, NAN);
+                    h_by_id[record.node_id] = record.h;
+                }
+                float h = record.node_id < h_by_id.size()
+                              ? h_by_id[record.node_id]
+                              : NAN;
+
+                // Nodes without a heuristic (parents named before their
+                // first record) are left out of the f layers
+                Layer unknown_f;
+                Layer& depth = by_depth[record.depth];
+                Layer& f = std::isnan(h) ? unknown_f : by_f[record.g + h];
+                switch (record.event) {
+                    case TraceEvent::kExpand:
+                        ++depth.expanded;
+                        ++f.expanded;
+                        break;
+                    case TraceEvent::kGenerate:
+                        ++depth.generated;
+                        ++f.generated;
+                        break;
+                    case TraceEvent::kDuplicate:
+                    case TraceEvent::kPrune:
+                        ++depth.duplicates;
+                        ++f.duplicates;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    } catch (const std::runtime_error& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    auto count = [&](TraceEvent event) {
+        return counts[static_cast<std::size_t>(event)];
+    };
+    uint64_t dropped =
+        count(TraceEvent::kDuplicate) + count(TraceEvent::kPrune);
+    uint64_t created = dropped + count(TraceEvent::kGenerate);
+
+    std::cout << "records         " << records << std::endl
+              << "generated       " << count(TraceEvent::kGenerate) << std::endl
+              << "expanded        " << count(TraceEvent::kExpand) << std::endl
+              << "duplicates      " << count(TraceEvent::kDuplicate)
+              << std::endl
+              << "pruned          " << count(TraceEvent::kPrune) << std::endl
+              << "goals           " << count(TraceEvent::kGoal) << std::endl
+              << "duplicate rate  " << std::fixed << std::setprecision(3)
+              << (created ? static_cast<double>(dropped) / created : 0.0)
+              << std::endl;
+
+    std::cout << std::setprecision(1);
+    PrintLayers("depth", by_depth);
+    PrintLayers("f", by_f);
+
+    return 0;
+}